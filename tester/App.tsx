@@ -18,8 +18,13 @@ import {NavigationContainer, Page} from './components';
 import {
   Benchmarker,
   DeepTree,
+  InterpolationEvaluate,
+  InterpolationParse,
+  JSIPropertyAccess,
+  ScrollInterpolation,
   SierpinskiTriangle,
   StressTest,
+  TouchMoveLatency,
 } from './benchmarks';
 import {PortalHost, PortalProvider} from '@gorhom/portal';
 import * as testSuiteByName from './tests';
@@ -80,6 +85,26 @@ function App() {
                 }
               />
             </Page>
+            <Page name="BENCHMARK: INTERPOLATION PARSE">
+              <Benchmarker
+                samplesCount={20}
+                renderContent={refreshKey => (
+                  <InterpolationParse key={refreshKey} viewsCount={200} />
+                )}
+              />
+            </Page>
+            <Page name="BENCHMARK: INTERPOLATION EVALUATE">
+              <InterpolationEvaluate viewsCount={200} durationInMs={5000} />
+            </Page>
+            <Page name="BENCHMARK: SCROLL INTERPOLATION">
+              <ScrollInterpolation rowsCount={300} durationInMs={6000} />
+            </Page>
+            <Page name="BENCHMARK: JSI PROPERTY ACCESS">
+              <JSIPropertyAccess iterationsCount={100000} />
+            </Page>
+            <Page name="BENCHMARK: TOUCH MOVE LATENCY">
+              <TouchMoveLatency />
+            </Page>
             <Page name="BENCHMARK: UPDATING COLORS">
               <Benchmarker
                 samplesCount={100}
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+import {useEffect, useMemo, useRef, useState} from 'react';
+import {Animated, Text, TouchableOpacity, View} from 'react-native';
+
+const STOPS_COUNT = 10;
+const INPUT_RANGE = Array.from({length: STOPS_COUNT}, (_, i) => i);
+const ROTATION_OUTPUT_RANGE = INPUT_RANGE.map(i => `${i * 36}deg`);
+const COLOR_OUTPUT_RANGE = INPUT_RANGE.map(
+  i => `rgba(${i * 25}, 0, ${255 - i * 25}, 1)`,
+);
+const TRANSLATION_OUTPUT_RANGE = INPUT_RANGE.map(i => (i % 2) * 8);
+
+/**
+ * Views animated by the native driver through a string (rotation), a color
+ * and a number interpolation with STOPS_COUNT stops each.
+ */
+function InterpolatedViews({
+  value,
+  viewsCount,
+}: {
+  value: Animated.Value;
+  viewsCount: number;
+}) {
+  return (
+    <View style={{flexDirection: 'row', flexWrap: 'wrap'}}>
+      {Array.from({length: viewsCount}, (_, i) => (
+        <Animated.View
+          key={i}
+          style={{
+            width: 16,
+            height: 16,
+            margin: 1,
+            backgroundColor: value.interpolate({
+              inputRange: INPUT_RANGE,
+              outputRange: COLOR_OUTPUT_RANGE,
+            }),
+            transform: [
+              {
+                rotate: value.interpolate({
+                  inputRange: INPUT_RANGE,
+                  outputRange: ROTATION_OUTPUT_RANGE,
+                }),
+              },
+              {
+                translateX: value.interpolate({
+                  inputRange: INPUT_RANGE,
+                  outputRange: TRANSLATION_OUTPUT_RANGE,
+                }),
+              },
+            ],
+          }}
+        />
+      ))}
+    </View>
+  );
+}
+
+/**
+ * Creates `viewsCount` views with three native interpolation nodes each.
+ * The nodes are created, and their ranges parsed, when the animation
+ * starts. Render it with the Benchmarker, so that every sample creates new
+ * nodes.
+ */
+export function InterpolationParse({viewsCount}: {viewsCount: number}) {
+  const value = useRef(new Animated.Value(0)).current;
+
+  useEffect(() => {
+    Animated.timing(value, {
+      toValue: STOPS_COUNT - 1,
+      duration: 0,
+      useNativeDriver: true,
+    }).start();
+  }, [value]);
+
+  return <InterpolatedViews value={value} viewsCount={viewsCount} />;
+}
+
+/**
+ * Animates `viewsCount` views through native interpolation nodes for
+ * `durationInMs`. A listener on the driving value receives one update per
+ * native frame, so the update rate drops once evaluating the interpolations
+ * no longer fits into a frame.
+ */
+export function InterpolationEvaluate({
+  viewsCount,
+  durationInMs,
+}: {
+  viewsCount: number;
+  durationInMs: number;
+}) {
+  const value = useRef(new Animated.Value(0)).current;
+  const [status, setStatus] = useState<'READY' | 'RUNNING' | 'FINISHED'>(
+    'READY',
+  );
+  const [updatesPerSecond, setUpdatesPerSecond] = useState<number>();
+  // status updates must not replace the interpolation nodes while they run
+  const views = useMemo(
+    () => <InterpolatedViews value={value} viewsCount={viewsCount} />,
+    [value, viewsCount],
+  );
+
+  function start() {
+    if (status === 'RUNNING') {
+      return;
+    }
+    setStatus('RUNNING');
+    value.setValue(0);
+    let updatesCount = 0;
+    const listenerId = value.addListener(() => {
+      updatesCount++;
+    });
+    const startTime = performance.now();
+    Animated.timing(value, {
+      toValue: STOPS_COUNT - 1,
+      duration: durationInMs,
+      useNativeDriver: true,
+    }).start(() => {
+      value.removeListener(listenerId);
+      setUpdatesPerSecond(
+        (updatesCount * 1000) / (performance.now() - startTime),
+      );
+      setStatus('FINISHED');
+    });
+  }
+
+  return (
+    <View style={{height: '100%', padding: 16, backgroundColor: 'white'}}>
+      <TouchableOpacity onPress={start}>
+        <Text
+          style={{
+            width: 200,
+            height: 32,
+            fontWeight: 'bold',
+            color: status !== 'RUNNING' ? 'blue' : 'black',
+          }}>
+          {status === 'RUNNING' ? 'Running...' : 'Start'}
+        </Text>
+      </TouchableOpacity>
+      <Text style={{width: 300, height: 32}}>
+        Interpolations {viewsCount * 3}
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Updates per second {updatesPerSecond?.toFixed(1) ?? '-'}
+      </Text>
+      {views}
+    </View>
+  );
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+import {useState} from 'react';
+import {Text, TouchableOpacity, View} from 'react-native';
+
+const PROPERTY_NAMES = [
+  'width',
+  'height',
+  'backgroundColor',
+  'borderRadius',
+  'opacity',
+  'transform',
+  'flexDirection',
+  'justifyContent',
+  'alignItems',
+  'padding',
+];
+
+/**
+ * Reads properties of a JSI HostObject in a loop, so that the time is spent
+ * mostly in the engine's JSI layer (creating PropNameIDs and converting them
+ * to strings). Run it on Hermes and on JSVM to compare the engines.
+ */
+export function JSIPropertyAccess({iterationsCount}: {iterationsCount: number}) {
+  const [durationInMs, setDurationInMs] = useState<number>();
+  const engine = (global as any).HermesInternal ? 'Hermes' : 'JSVM/ArkJS';
+
+  function start() {
+    const hostObject = (global as any).nativeFabricUIManager;
+    const startTime = performance.now();
+    let definedCount = 0;
+    for (let i = 0; i < iterationsCount; i++) {
+      for (const propertyName of PROPERTY_NAMES) {
+        if (hostObject[propertyName] !== undefined) {
+          definedCount++;
+        }
+      }
+    }
+    setDurationInMs(performance.now() - startTime);
+    if (definedCount > 0) {
+      console.warn('JSIPropertyAccess: unexpected defined properties');
+    }
+  }
+
+  return (
+    <View style={{height: '100%', padding: 16, backgroundColor: 'white'}}>
+      <TouchableOpacity onPress={start}>
+        <Text
+          style={{width: 200, height: 32, fontWeight: 'bold', color: 'blue'}}>
+          Start
+        </Text>
+      </TouchableOpacity>
+      <Text style={{width: 300, height: 32}}>Engine {engine}</Text>
+      <Text style={{width: 300, height: 32}}>
+        Property reads {iterationsCount * PROPERTY_NAMES.length}
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Duration {durationInMs?.toFixed(1) ?? '-'} ms
+      </Text>
+    </View>
+  );
+}
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+import {useMemo, useRef, useState} from 'react';
+import {Animated, ScrollView, Text, TouchableOpacity, View} from 'react-native';
+
+const ROW_HEIGHT = 48;
+const ROW_GAP = 4;
+const ROW_STRIDE = ROW_HEIGHT + ROW_GAP;
+const VIEWPORT_HEIGHT = 400;
+
+/**
+ * A row that fades, slides and scales in when it enters the viewport and
+ * out when it leaves, with four native interpolation nodes driven by the
+ * scroll offset.
+ */
+function InterpolatedRow({
+  index,
+  scrollY,
+}: {
+  index: number;
+  scrollY: Animated.Value;
+}) {
+  const rowTop = index * ROW_STRIDE;
+  const inputRange = [
+    rowTop - VIEWPORT_HEIGHT,
+    rowTop - VIEWPORT_HEIGHT + ROW_STRIDE,
+    rowTop,
+    rowTop + ROW_STRIDE,
+  ];
+  return (
+    <Animated.View
+      style={{
+        height: ROW_HEIGHT,
+        marginBottom: ROW_GAP,
+        opacity: scrollY.interpolate({
+          inputRange,
+          outputRange: [0, 1, 1, 0],
+          extrapolate: 'clamp',
+        }),
+        backgroundColor: scrollY.interpolate({
+          inputRange,
+          outputRange: [
+            'rgba(0, 0, 255, 1)',
+            'rgba(0, 128, 255, 1)',
+            'rgba(0, 255, 128, 1)',
+            'rgba(0, 255, 0, 1)',
+          ],
+          extrapolate: 'clamp',
+        }),
+        transform: [
+          {
+            translateX: scrollY.interpolate({
+              inputRange,
+              outputRange: [-40, 0, 0, 40],
+              extrapolate: 'clamp',
+            }),
+          },
+          {
+            scale: scrollY.interpolate({
+              inputRange,
+              outputRange: [0.8, 1, 1, 0.8],
+              extrapolate: 'clamp',
+            }),
+          },
+        ],
+      }}
+    />
+  );
+}
+
+/**
+ * Scrolls a list of `rowsCount` rows whose styles are interpolated from the
+ * scroll offset by the native driver. Start scrolls to the end and back,
+ * and the updates of the offset value are counted for `durationInMs`. The
+ * update rate drops once evaluating the animated node graph no longer fits
+ * into a frame.
+ */
+export function ScrollInterpolation({
+  rowsCount,
+  durationInMs,
+}: {
+  rowsCount: number;
+  durationInMs: number;
+}) {
+  const scrollY = useRef(new Animated.Value(0)).current;
+  const scrollViewRef = useRef<ScrollView>(null);
+  const [status, setStatus] = useState<'READY' | 'RUNNING' | 'FINISHED'>(
+    'READY',
+  );
+  const [updatesPerSecond, setUpdatesPerSecond] = useState<number>();
+  const onScroll = useMemo(
+    () =>
+      Animated.event([{nativeEvent: {contentOffset: {y: scrollY}}}], {
+        useNativeDriver: true,
+      }),
+    [scrollY],
+  );
+  // status updates must not replace the interpolation nodes while they run
+  const rows = useMemo(
+    () =>
+      Array.from({length: rowsCount}, (_, i) => (
+        <InterpolatedRow key={i} index={i} scrollY={scrollY} />
+      )),
+    [rowsCount, scrollY],
+  );
+
+  function start() {
+    if (status === 'RUNNING') {
+      return;
+    }
+    setStatus('RUNNING');
+    let updatesCount = 0;
+    let firstUpdateTime: number | undefined;
+    let lastUpdateTime = 0;
+    const listenerId = scrollY.addListener(() => {
+      lastUpdateTime = performance.now();
+      if (firstUpdateTime === undefined) {
+        firstUpdateTime = lastUpdateTime;
+      }
+      updatesCount++;
+    });
+    const endOffset = rowsCount * ROW_STRIDE - VIEWPORT_HEIGHT;
+    scrollViewRef.current?.scrollTo({y: endOffset, animated: true});
+    setTimeout(() => {
+      scrollViewRef.current?.scrollTo({y: 0, animated: true});
+    }, durationInMs / 2);
+    setTimeout(() => {
+      scrollY.removeListener(listenerId);
+      setUpdatesPerSecond(
+        firstUpdateTime !== undefined && lastUpdateTime > firstUpdateTime
+          ? ((updatesCount - 1) * 1000) / (lastUpdateTime - firstUpdateTime)
+          : undefined,
+      );
+      setStatus('FINISHED');
+    }, durationInMs);
+  }
+
+  return (
+    <View style={{height: '100%', padding: 16, backgroundColor: 'white'}}>
+      <TouchableOpacity onPress={start}>
+        <Text
+          style={{
+            width: 200,
+            height: 32,
+            fontWeight: 'bold',
+            color: status !== 'RUNNING' ? 'blue' : 'black',
+          }}>
+          {status === 'RUNNING' ? 'Running...' : 'Start'}
+        </Text>
+      </TouchableOpacity>
+      <Text style={{width: 300, height: 32}}>
+        Interpolations {rowsCount * 4}
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Updates per second {updatesPerSecond?.toFixed(1) ?? '-'}
+      </Text>
+      <Animated.ScrollView
+        ref={scrollViewRef}
+        style={{height: VIEWPORT_HEIGHT, flexGrow: 0}}
+        onScroll={onScroll}
+        scrollEventThrottle={1}>
+        {rows}
+      </Animated.ScrollView>
+    </View>
+  );
+}
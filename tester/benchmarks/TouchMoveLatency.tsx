@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+import {useRef, useState} from 'react';
+import {GestureResponderEvent, Text, View} from 'react-native';
+
+type Stats = {
+  movesCount: number;
+  samplesCount: number;
+  durationInMs: number;
+  averageLagInMs: number;
+  maxLagInMs: number;
+};
+
+/**
+ * Measures how touch moves reach JS while dragging a finger over the panel.
+ * The native clock and the JS clock don't share an origin, so the lag of a
+ * move is measured relative to the first move of the gesture: it's the time
+ * that passed in JS minus the time that passed between the native samples.
+ * A growing lag means events queue up faster than JS consumes them.
+ * Samples also count the `historicalTouches` coalesced into each move.
+ */
+export function TouchMoveLatency() {
+  const [stats, setStats] = useState<Stats>();
+  const gestureRef = useRef<{
+    firstNativeTimestamp: number;
+    firstJSTimestamp: number;
+    movesCount: number;
+    samplesCount: number;
+    lagSumInMs: number;
+    maxLagInMs: number;
+  }>();
+
+  function onTouchStart() {
+    gestureRef.current = undefined;
+  }
+
+  function onTouchMove(event: GestureResponderEvent) {
+    const jsTimestamp = performance.now();
+    const nativeTimestamp = event.nativeEvent.timestamp;
+    const historicalTouches = (
+      event.nativeEvent as {historicalTouches?: unknown[]}
+    ).historicalTouches;
+    const samplesCount = 1 + (historicalTouches?.length ?? 0);
+    const gesture = gestureRef.current;
+    if (gesture === undefined) {
+      gestureRef.current = {
+        firstNativeTimestamp: nativeTimestamp,
+        firstJSTimestamp: jsTimestamp,
+        movesCount: 1,
+        samplesCount,
+        lagSumInMs: 0,
+        maxLagInMs: 0,
+      };
+      return;
+    }
+    const lagInMs =
+      jsTimestamp -
+      gesture.firstJSTimestamp -
+      (nativeTimestamp - gesture.firstNativeTimestamp);
+    gesture.movesCount++;
+    gesture.samplesCount += samplesCount;
+    gesture.lagSumInMs += lagInMs;
+    gesture.maxLagInMs = Math.max(gesture.maxLagInMs, lagInMs);
+  }
+
+  function onTouchEnd() {
+    const gesture = gestureRef.current;
+    if (gesture === undefined || gesture.movesCount < 2) {
+      return;
+    }
+    setStats({
+      movesCount: gesture.movesCount,
+      samplesCount: gesture.samplesCount,
+      durationInMs: performance.now() - gesture.firstJSTimestamp,
+      averageLagInMs: gesture.lagSumInMs / (gesture.movesCount - 1),
+      maxLagInMs: gesture.maxLagInMs,
+    });
+  }
+
+  return (
+    <View style={{height: '100%', padding: 16, backgroundColor: 'white'}}>
+      <Text style={{width: 300, height: 32}}>
+        Moves {stats?.movesCount ?? '-'}
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Moves per second{' '}
+        {stats
+          ? ((stats.movesCount * 1000) / stats.durationInMs).toFixed(1)
+          : '-'}
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Samples per second{' '}
+        {stats
+          ? ((stats.samplesCount * 1000) / stats.durationInMs).toFixed(1)
+          : '-'}
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Average lag {stats?.averageLagInMs.toFixed(1) ?? '-'} ms
+      </Text>
+      <Text style={{width: 300, height: 32}}>
+        Max lag {stats?.maxLagInMs.toFixed(1) ?? '-'} ms
+      </Text>
+      <View
+        style={{flex: 1, backgroundColor: 'lightgray'}}
+        onTouchStart={onTouchStart}
+        onTouchMove={onTouchMove}
+        onTouchEnd={onTouchEnd}>
+        <Text style={{width: 300, height: 32}}>Drag here</Text>
+      </View>
+    </View>
+  );
+}
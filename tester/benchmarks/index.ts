@@ -7,5 +7,9 @@
 
 export * from './DeepTree';
 export * from './Benchmarker';
+export * from './Interpolation';
+export * from './JSIPropertyAccess';
+export * from './ScrollInterpolation';
 export * from './SierpinskiTriangle';
 export * from './stresstest/StressTest';
+export * from './TouchMoveLatency';
@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <react/renderer/graphics/Color.h>
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/graphics/Transform.h>
+
+namespace rnoh {
+
+/**
+ * @internal
+ * Values of the props most commonly driven by native Animated, which can be
+ * applied to a ComponentInstance without building and parsing RawProps.
+ * `transform` is the already composed matrix, `translateX`/`translateY`
+ * included.
+ */
+struct AnimatedProps {
+  std::optional<facebook::react::Float> opacity;
+  std::optional<facebook::react::Transform> transform;
+  std::optional<facebook::react::SharedColor> backgroundColor;
+
+  bool empty() const {
+    return !opacity.has_value() && !transform.has_value() &&
+        !backgroundColor.has_value();
+  }
+};
+
+} // namespace rnoh
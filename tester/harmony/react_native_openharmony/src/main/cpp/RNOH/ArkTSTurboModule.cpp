@@ -13,6 +13,7 @@
 #include <exception>
 
 #include "ArkTSTurboModule.h"
+#include "RNOH/JSValueBuffer.h"
 #include "RNOH/JsiConversions.h"
 #include "RNOH/TaskExecutor/TaskExecutor.h"
 
@@ -34,12 +35,30 @@ facebook::jsi::Value preparePromiseResolverResult(
 std::string preparePromiseRejectionResult(
     const std::vector<folly::dynamic> args);
 
+static JSValueBuffer createArgsBuffer(
+    jsi::Runtime& runtime,
+    std::shared_ptr<react::CallInvoker> const& jsInvoker,
+    const jsi::Value* jsiArgs,
+    size_t argsCount) {
+  return JSValueBuffer::fromJSIValues(
+      runtime,
+      jsiArgs,
+      argsCount,
+      [&jsInvoker](jsi::Runtime& rt, jsi::Function&& function) {
+        return createIntermediaryCallback(
+            react::CallbackWrapper::createWeak(
+                std::move(function), rt, jsInvoker),
+            jsInvoker);
+      });
+}
+
 TurboModule::~TurboModule() {};
 
 ArkTSTurboModule::ArkTSTurboModule(Context ctx, std::string name)
     : m_ctx(ctx), TurboModule(ctx, name) {}
 
 ArkTSTurboModule::~ArkTSTurboModule() noexcept {
+  flushScheduledCalls();
   auto taskExecutor = m_ctx.taskExecutor;
   taskExecutor->runTask(
       m_ctx.turboModuleThread,
@@ -56,9 +75,21 @@ jsi::Value ArkTSTurboModule::call(
                                "#RNOH::ArkTSTurboModule::call (" + this->name_ +
                                "::" + methodName + ")")
                                .c_str());
-  auto args = convertJSIValuesToIntermediaryValues(
-      runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
-  return jsi::valueFromDynamic(runtime, callSync(methodName, std::move(args)));
+  throwIfArkTSTurboModuleIsMissing();
+  // arguments and the result are converted directly between JSI and NAPI
+  // values, without building folly::dynamic trees in between
+  auto args =
+      createArgsBuffer(runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
+  JSValueBuffer result;
+  runSyncCall(
+      "call",
+      methodName,
+      [&](ArkJS& arkJS, RNOHNapiObject& napiTurboModuleObject) {
+        auto napiResult =
+            napiTurboModuleObject.call(methodName, args.toNapiValues(arkJS));
+        result = JSValueBuffer::fromNapiValue(arkJS, napiResult);
+      });
+  return result.toJSIValue(runtime);
 }
 
 // the cpp side calls a ArkTs TurboModule method and blocks until it returns,
@@ -70,34 +101,53 @@ folly::dynamic ArkTSTurboModule::callSync(
                                "#RNOH::ArkTSTurboModule::callSync (" +
                                this->name_ + "::" + methodName + ")")
                                .c_str());
-  auto start = std::chrono::high_resolution_clock::now();
+  throwIfArkTSTurboModuleIsMissing();
+  folly::dynamic result;
+  runSyncCall(
+      "callSync",
+      methodName,
+      [&](ArkJS& arkJS, RNOHNapiObject& napiTurboModuleObject) {
+        auto napiArgs =
+            arkJS.convertIntermediaryValuesToNapiValues(std::move(args));
+        auto napiResult = napiTurboModuleObject.call(methodName, napiArgs);
+        result = arkJS.getDynamic(napiResult);
+      });
+  return result;
+}
 
+void ArkTSTurboModule::throwIfArkTSTurboModuleIsMissing() const {
   if (!m_ctx.arkTSTurboModuleInstanceRef) {
     auto errorMsg = "Couldn't find turbo module '" + name_ +
         "' on ArkUI side. Did you link RNPackage that provides this turbo module?";
     LOG(FATAL) << errorMsg;
     throw std::runtime_error(errorMsg);
   }
-  folly::dynamic result;
+}
+
+void ArkTSTurboModule::runSyncCall(
+    const char* callerName,
+    const std::string& methodName,
+    std::function<void(ArkJS&, RNOHNapiObject&)> const& callMethod) {
+  auto start = std::chrono::high_resolution_clock::now();
   m_ctx.taskExecutor->runSyncTask(
-      m_ctx.turboModuleThread, [ctx = m_ctx, &methodName, &args, &result]() {
+      m_ctx.turboModuleThread,
+      [ctx = m_ctx, name = name_, queue = m_scheduledCallsQueue, &callMethod] {
+        // the sync task may run before the posted flush, so calls scheduled
+        // earlier are run here to keep their order
+        runPendingScheduledCalls(ctx, name, *queue);
         ArkJS arkJS(ctx.env);
-        auto napiArgs =
-            arkJS.convertIntermediaryValuesToNapiValues(std::move(args));
         auto napiTurboModuleObject =
             arkJS.getObject(ctx.arkTSTurboModuleInstanceRef);
-        auto napiResult = napiTurboModuleObject.call(methodName, napiArgs);
-        result = arkJS.getDynamic(napiResult);
+        callMethod(arkJS, napiTurboModuleObject);
       });
   auto stop = std::chrono::high_resolution_clock::now();
   auto duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
   if (duration.count() > 2) {
-    DLOG(WARNING) << "ArkTSTurboModule::callSync: execution time — "
-                  << duration.count()
+    DLOG(WARNING) << "ArkTSTurboModule::" << callerName
+                  << ": execution time — " << duration.count()
                   << " ms (" + this->name_ + "::" + methodName + ")";
   }
-  return result;
 }
 
 // calls a TurboModule method without blocking and ignores its result
@@ -110,34 +160,118 @@ void rnoh::ArkTSTurboModule::scheduleCall(
                                "#RNOH::ArkTSTurboModule::scheduleCall (" +
                                this->name_ + "::" + methodName + ")")
                                .c_str());
-  if (!m_ctx.arkTSTurboModuleInstanceRef) {
-    auto errorMsg = "Couldn't find turbo module '" + name_ +
-        "' on ArkUI side. Did you link RNPackage that provides this turbo module?";
-    LOG(FATAL) << errorMsg;
-    throw std::runtime_error(errorMsg);
+  throwIfArkTSTurboModuleIsMissing();
+  auto args =
+      createArgsBuffer(runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
+  auto& queue = *m_scheduledCallsQueue;
+  if (!shouldBatchScheduledCalls()) {
+    {
+      std::lock_guard lock(queue.mtx);
+      queue.calls.push_back({methodName, std::move(args)});
+    }
+    flushScheduledCalls();
+    return;
   }
-  auto args = convertJSIValuesToIntermediaryValues(
-      runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
-  m_ctx.taskExecutor->runTask(
-      m_ctx.turboModuleThread,
-      [ctx = m_ctx,
-       name = name_,
-       methodName,
-       args = std::move(args),
-       &runtime]() mutable {
-        try {
-          ArkJS arkJS(ctx.env);
-          auto napiArgs =
-              arkJS.convertIntermediaryValuesToNapiValues(std::move(args));
-          auto napiTurboModuleObject =
-              arkJS.getObject(ctx.arkTSTurboModuleInstanceRef);
-          napiTurboModuleObject.call(methodName, napiArgs);
-        } catch (const std::exception& e) {
-          LOG(ERROR) << "Exception thrown while calling " << name
-                     << " TurboModule method " << methodName << ": "
-                     << e.what();
-        }
+  bool shouldScheduleFlush = false;
+  bool isBatchFull = false;
+  {
+    std::lock_guard lock(queue.mtx);
+    queue.calls.push_back({methodName, std::move(args)});
+    isBatchFull = queue.calls.size() >= MAX_SCHEDULED_CALLS_BATCH_SIZE;
+    shouldScheduleFlush = !isBatchFull && !queue.isFlushScheduled;
+    queue.isFlushScheduled = queue.isFlushScheduled || shouldScheduleFlush;
+  }
+  if (isBatchFull) {
+    flushScheduledCalls();
+  } else if (shouldScheduleFlush) {
+    // runs after the JS task that made the call, so that all calls made
+    // during that task are sent together; the module may be destroyed by
+    // then, so the flush only uses copies of its context, name and queue
+    m_ctx.jsInvoker->invokeAsync(
+        [ctx = m_ctx, name = name_, queue = m_scheduledCallsQueue]() mutable {
+          if (!flushScheduledCalls(ctx, name, queue)) {
+            // the copied instance ref may be the last one, and must be
+            // released on the turbo module thread
+            auto taskExecutor = ctx.taskExecutor;
+            taskExecutor->runTask(
+                ctx.turboModuleThread,
+                [ref = std::move(ctx.arkTSTurboModuleInstanceRef)] {});
+          }
+        });
+  }
+}
+
+void ArkTSTurboModule::flushScheduledCalls() {
+  auto ctx = m_ctx;
+  flushScheduledCalls(ctx, name_, m_scheduledCallsQueue);
+}
+
+bool ArkTSTurboModule::flushScheduledCalls(
+    Context& ctx,
+    std::string const& name,
+    std::shared_ptr<ScheduledCallsQueue> const& queue) {
+  {
+    std::lock_guard lock(queue->mtx);
+    queue->isFlushScheduled = false;
+    if (queue->calls.empty() || queue->isRunPosted) {
+      return false;
+    }
+    queue->isRunPosted = true;
+  }
+  // the task takes the calls from the queue when it runs, so that a sync call
+  // which ran in the meantime could run them first
+  auto taskExecutor = ctx.taskExecutor;
+  auto turboModuleThread = ctx.turboModuleThread;
+  taskExecutor->runTask(
+      turboModuleThread, [ctx = std::move(ctx), name, queue] {
+        runPendingScheduledCalls(ctx, name, *queue);
       });
+  return true;
+}
+
+void ArkTSTurboModule::runPendingScheduledCalls(
+    Context const& ctx,
+    std::string const& name,
+    ScheduledCallsQueue& queue) {
+  std::vector<ScheduledCall> calls;
+  {
+    std::lock_guard lock(queue.mtx);
+    queue.isRunPosted = false;
+    if (queue.calls.empty()) {
+      return;
+    }
+    std::swap(calls, queue.calls);
+  }
+  react::SystraceSection s(
+      std::string(
+          "#RNOH::ArkTSTurboModule::runScheduledCalls (" + name + ", " +
+          std::to_string(calls.size()) + ")")
+          .c_str());
+  runScheduledCalls(ctx, name, calls);
+}
+
+void ArkTSTurboModule::runScheduledCalls(
+    Context const& ctx,
+    std::string const& name,
+    std::vector<ScheduledCall>& calls) {
+  ArkJS arkJS(ctx.env);
+  auto napiTurboModuleObject =
+      arkJS.getObject(ctx.arkTSTurboModuleInstanceRef);
+  for (auto& call : calls) {
+    // each call gets its own scope, so that the NAPI values of a large batch
+    // don't pile up until the task ends
+    napi_handle_scope scope;
+    napi_open_handle_scope(ctx.env, &scope);
+    try {
+      napiTurboModuleObject.call(
+          call.methodName, call.args.toNapiValues(arkJS));
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception thrown while calling " << name
+                 << " TurboModule method " << call.methodName << ": "
+                 << e.what();
+    }
+    napi_close_handle_scope(ctx.env, scope);
+  }
 }
 
 // calls an async TurboModule method and returns a Promise
@@ -150,14 +284,10 @@ jsi::Value ArkTSTurboModule::callAsync(
                                "#RNOH::ArkTSTurboModule::callAsync (" +
                                this->name_ + "::" + methodName + ")")
                                .c_str());
-  if (!m_ctx.arkTSTurboModuleInstanceRef) {
-    auto errorMsg = "Couldn't find turbo module '" + name_ +
-        "' on ArkUI side. Did you link RNPackage that provides this turbo module?";
-    LOG(FATAL) << errorMsg;
-    throw std::runtime_error(errorMsg);
-  }
-  auto args = convertJSIValuesToIntermediaryValues(
-      runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
+  throwIfArkTSTurboModuleIsMissing();
+  flushScheduledCalls();
+  auto args =
+      createArgsBuffer(runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
   return react::createPromiseAsJSIValue(
       runtime,
       [&, args = std::move(args)](
@@ -179,10 +309,7 @@ jsi::Value ArkTSTurboModule::callAsync(
               try {
                 auto n_promisedResult =
                     arkJS.getObject(arkTSTurboModuleInstanceRef)
-                        .call(
-                            methodName,
-                            arkJS.convertIntermediaryValuesToNapiValues(
-                                std::move(args)));
+                        .call(methodName, args.toNapiValues(arkJS));
                 Promise(env, n_promisedResult)
                     .then(
                         [&runtime2, weakJsiPromise, env, jsInvoker](auto args) {
@@ -10,10 +10,13 @@
 #include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
 #include <react/renderer/scheduler/Scheduler.h>
+#include <functional>
+#include <mutex>
 #include "TaskExecutor/TaskExecutor.h"
 
 #include "ArkJS.h"
 #include "RNOH/EventDispatcher.h"
+#include "RNOH/JSValueBuffer.h"
 #include "RNOH/MessageQueueThread.h"
 #include "RNOH/TaskExecutor/TaskExecutor.h"
 #include "RNOH/TurboModule.h"
@@ -116,6 +119,12 @@ class ArkTSTurboModule : public TurboModule {
       const std::string& methodName,
       std::vector<ArkJS::IntermediaryArg> args);
 
+  /**
+   * Calls made by JS are queued and sent to the turbo module thread as one
+   * task after the current JS task, or earlier when
+   * MAX_SCHEDULED_CALLS_BATCH_SIZE calls are queued. Calls keep their order
+   * relative to all other calls of this module.
+   */
   void scheduleCall(
       facebook::jsi::Runtime& runtime,
       const std::string& methodName,
@@ -140,6 +149,75 @@ class ArkTSTurboModule : public TurboModule {
   }
 
  protected:
+  /**
+   * Modules whose scheduled calls are latency sensitive can return false to
+   * send each call to the turbo module thread as soon as it's made.
+   */
+  virtual bool shouldBatchScheduledCalls() const {
+    return true;
+  }
+
   Context m_ctx;
+
+ private:
+  static constexpr size_t MAX_SCHEDULED_CALLS_BATCH_SIZE = 64;
+
+  void throwIfArkTSTurboModuleIsMissing() const;
+
+  /**
+   * Calls `callMethod` with the ArkTS turbo module object on the turbo
+   * module thread and blocks until it returns. `callerName` is used when
+   * reporting slow calls.
+   */
+  void runSyncCall(
+      const char* callerName,
+      const std::string& methodName,
+      std::function<void(ArkJS&, RNOHNapiObject&)> const& callMethod);
+
+  struct ScheduledCall {
+    std::string methodName;
+    JSValueBuffer args;
+  };
+
+  struct ScheduledCallsQueue {
+    std::mutex mtx;
+    std::vector<ScheduledCall> calls;
+    bool isFlushScheduled = false;
+    bool isRunPosted = false;
+  };
+
+  /**
+   * Posts a task running the queued scheduled calls on the turbo module
+   * thread. Called before async calls of this module, so that calls keep
+   * their order.
+   */
+  void flushScheduledCalls();
+
+  /**
+   * Doesn't use the module, so that it can run after the module is
+   * destroyed. Returns true if a task was posted, in which case `ctx` was
+   * moved into it.
+   */
+  static bool flushScheduledCalls(
+      Context& ctx,
+      std::string const& name,
+      std::shared_ptr<ScheduledCallsQueue> const& queue);
+
+  /**
+   * Runs the queued scheduled calls on the turbo module thread. Sync calls
+   * run them first, as they may overtake the task posted by the flush.
+   */
+  static void runPendingScheduledCalls(
+      Context const& ctx,
+      std::string const& name,
+      ScheduledCallsQueue& queue);
+
+  static void runScheduledCalls(
+      Context const& ctx,
+      std::string const& name,
+      std::vector<ScheduledCall>& calls);
+
+  std::shared_ptr<ScheduledCallsQueue> m_scheduledCallsQueue =
+      std::make_shared<ScheduledCallsQueue>();
 };
 } // namespace rnoh
@@ -62,6 +62,18 @@ class ArkUITypography final {
     return OH_Drawing_TypographyGetLongestLine(m_typography.get()) / m_scale;
   }
 
+  size_t getLineCount() const {
+    return OH_Drawing_TypographyGetLineCount(m_typography.get());
+  }
+
+  size_t getUtf16Length() const {
+    size_t length = 0;
+    for (auto fragmentLength : m_fragmentLengths) {
+      length += fragmentLength;
+    }
+    return length;
+  }
+
   bool getExceedMaxLines() const {
     return OH_Drawing_TypographyDidExceedMaxLines(m_typography.get());
   }
@@ -123,48 +135,53 @@ class ArkUITypography final {
             OH_Drawing_DestroyTypography),
         m_attachmentCount(attachmentCount),
         m_fragmentLengths(std::move(fragmentLengths)),
-        m_scale(scale) {
-            OH_Drawing_TypographyLayout(m_typography.get(), maxWidth);
-            std::shared_ptr<OH_Drawing_LineMetrics> lineMetrics(
-                OH_Drawing_TypographyGetLineMetrics(m_typography.get()),
-                OH_Drawing_DestroyLineMetrics);
-            if (lineMetrics) {
-              m_offset.x = lineMetrics->x;
-              m_offset.y = lineMetrics->y;
-            }
-            if (textAlign.has_value()) {
-              auto longestWidth =
-                  OH_Drawing_TypographyGetLongestLine(m_typography.get());
-              switch (textAlign.value()) {
-                case facebook::react::TextAlignment::Right:
-                  m_offset.x = maxWidth - longestWidth;
-                  break;
-                case facebook::react::TextAlignment::Center:
-                  m_offset.x = (maxWidth - longestWidth) / 2;
-                  break;
-                default:
-                  break;
-              }
-            }
-            // TextComponentInstance implements left margin by layoutConstraints
-            // typography doesn't need to, also shouldn't, have left margin
-            // do re-layout here using the longest line width as max width to
-            // eliminate the left margin
-            //
-            // The return value of the OH_Drawing_TypographyGetLongestLine ()
-            // interface needs to be rounded up; otherwise, abnormal text line
-            // breaks may occur on some devices, such as mate 70 pro.
-            if (!textAlign.has_value() || textAlign.value() != facebook::react::TextAlignment::Justified) {
-              auto longestWidth =
-                  std::ceil(OH_Drawing_TypographyGetLongestLine(m_typography.get()));
-              if (std::isfinite(maxWidth) && maxWidth > 0) {
-                longestWidth = std::min(longestWidth, maxWidth);
-              }
-              OH_Drawing_TypographyLayout(
-                  m_typography.get(),
-                  longestWidth);
-            }
-        }
+        m_scale(scale),
+        m_textAlign(textAlign) {
+    layout(maxWidth);
+  }
+
+  void layout(facebook::react::Float maxWidth) {
+    OH_Drawing_TypographyLayout(m_typography.get(), maxWidth);
+    std::shared_ptr<OH_Drawing_LineMetrics> lineMetrics(
+        OH_Drawing_TypographyGetLineMetrics(m_typography.get()),
+        OH_Drawing_DestroyLineMetrics);
+    if (lineMetrics) {
+      m_offset.x = lineMetrics->x;
+      m_offset.y = lineMetrics->y;
+    }
+    if (m_textAlign.has_value()) {
+      auto longestWidth =
+          OH_Drawing_TypographyGetLongestLine(m_typography.get());
+      switch (m_textAlign.value()) {
+        case facebook::react::TextAlignment::Right:
+          m_offset.x = maxWidth - longestWidth;
+          break;
+        case facebook::react::TextAlignment::Center:
+          m_offset.x = (maxWidth - longestWidth) / 2;
+          break;
+        default:
+          break;
+      }
+    }
+    // TextComponentInstance implements left margin by layoutConstraints
+    // typography doesn't need to, also shouldn't, have left margin
+    // do re-layout here using the longest line width as max width to
+    // eliminate the left margin
+    //
+    // The return value of the OH_Drawing_TypographyGetLongestLine ()
+    // interface needs to be rounded up; otherwise, abnormal text line
+    // breaks may occur on some devices, such as mate 70 pro.
+    if (!m_textAlign.has_value() || m_textAlign.value() != facebook::react::TextAlignment::Justified) {
+      auto longestWidth =
+          std::ceil(OH_Drawing_TypographyGetLongestLine(m_typography.get()));
+      if (std::isfinite(maxWidth) && maxWidth > 0) {
+        longestWidth = std::min(longestWidth, maxWidth);
+      }
+      OH_Drawing_TypographyLayout(
+          m_typography.get(),
+          longestWidth);
+    }
+  }
 
   std::shared_ptr<OH_Drawing_Typography>
           m_typography;
@@ -172,6 +189,7 @@ class ArkUITypography final {
   std::vector<size_t> m_fragmentLengths;
 
   float m_scale = 1.0;
+  std::optional<facebook::react::TextAlignment> m_textAlign;
   facebook::react::Point m_offset;
   friend class ArkUITypographyBuilder;
 };
@@ -190,12 +208,15 @@ class ArkUITypographyBuilder final {
         m_defaultFontFamilyName(defaultFontFamilyName),
         m_fontCollection(fontCollection) {}
     
-    void setMaximumWidth(facebook::react::Float maximumWidth) {
+    static facebook::react::Float getMaximumWidth(facebook::react::Float maximumWidth) {
         if (!isnan(maximumWidth) && maximumWidth > 0) {
-            m_maximumWidth = maximumWidth;
-        } else {
-            m_maximumWidth = std::numeric_limits<facebook::react::Float>::max();
+            return maximumWidth;
         }
+        return std::numeric_limits<facebook::react::Float>::max();
+    }
+
+    void setMaximumWidth(facebook::react::Float maximumWidth) {
+        m_maximumWidth = getMaximumWidth(maximumWidth);
     }
 
   void addFragment(
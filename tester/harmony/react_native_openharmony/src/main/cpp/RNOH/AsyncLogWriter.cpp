@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "AsyncLogWriter.h"
+#include <pthread.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+#define LOG_DOMAIN 0xBEEF
+
+namespace rnoh {
+
+static constexpr auto DRAIN_INTERVAL = std::chrono::milliseconds(16);
+
+AsyncLogWriter& AsyncLogWriter::getInstance() {
+  // never destroyed, so that threads can log during static destruction
+  static auto instance = new AsyncLogWriter();
+  return *instance;
+}
+
+AsyncLogWriter::AsyncLogWriter() {
+  m_drainerThread = std::thread([this] { runDrainer(); });
+  m_drainerThread.detach();
+}
+
+bool AsyncLogWriter::write(
+    LogLevel level,
+    const char* tag,
+    std::initializer_list<std::string_view> parts) {
+  size_t length = 0;
+  for (auto const& part : parts) {
+    length += part.size();
+  }
+  if (length > MAX_LINE_LENGTH) {
+    return false;
+  }
+  auto& ring = *getThreadRing();
+  auto head = ring.head.load(std::memory_order_relaxed);
+  auto queuedLinesCount = head - ring.tail.load(std::memory_order_acquire);
+  if (queuedLinesCount == RING_CAPACITY) {
+    ring.droppedLinesCount.fetch_add(1, std::memory_order_relaxed);
+    m_cv.notify_one();
+    return true;
+  }
+  auto& line = ring.lines[head % RING_CAPACITY];
+  line.level = level;
+  line.tag = tag;
+  line.length = length;
+  auto text = line.text.data();
+  for (auto const& part : parts) {
+    std::memcpy(text, part.data(), part.size());
+    text += part.size();
+  }
+  *text = '\0';
+  ring.head.store(head + 1, std::memory_order_release);
+  if (queuedLinesCount + 1 >= RING_CAPACITY / 2) {
+    // a missed notification only delays draining until the next interval
+    m_cv.notify_one();
+  }
+  return true;
+}
+
+void AsyncLogWriter::flush() {
+  drain();
+}
+
+std::shared_ptr<AsyncLogWriter::Ring> const& AsyncLogWriter::getThreadRing() {
+  thread_local std::shared_ptr<Ring> ring;
+  if (ring == nullptr) {
+    ring = std::make_shared<Ring>();
+    std::lock_guard lock(m_mtx);
+    m_rings.push_back(ring);
+  }
+  return ring;
+}
+
+void AsyncLogWriter::drain() {
+  std::lock_guard drainLock(m_drainMtx);
+  std::vector<std::shared_ptr<Ring>> rings;
+  {
+    std::lock_guard lock(m_mtx);
+    rings = m_rings;
+  }
+  for (auto const& ring : rings) {
+    auto tail = ring->tail.load(std::memory_order_relaxed);
+    auto head = ring->head.load(std::memory_order_acquire);
+    for (; tail != head; tail++) {
+      auto const& line = ring->lines[tail % RING_CAPACITY];
+      OH_LOG_Print(
+          LOG_APP,
+          line.level,
+          LOG_DOMAIN,
+          line.tag,
+          "%{public}s",
+          line.text.data());
+    }
+    ring->tail.store(tail, std::memory_order_release);
+    auto droppedLinesCount =
+        ring->droppedLinesCount.exchange(0, std::memory_order_relaxed);
+    if (droppedLinesCount > 0) {
+      OH_LOG_Print(
+          LOG_APP,
+          LOG_WARN,
+          LOG_DOMAIN,
+          "#RNOH_CPP",
+          "%{public}s log lines dropped",
+          std::to_string(droppedLinesCount).c_str());
+    }
+  }
+  rings.clear();
+  // rings of exited threads are only referenced by this writer, and are
+  // kept until the lines and drops they got after being drained are written
+  std::lock_guard lock(m_mtx);
+  m_rings.erase(
+      std::remove_if(
+          m_rings.begin(),
+          m_rings.end(),
+          [](auto const& ring) {
+            return ring.use_count() == 1 &&
+                ring->head.load(std::memory_order_acquire) ==
+                ring->tail.load(std::memory_order_relaxed) &&
+                ring->droppedLinesCount.load(std::memory_order_relaxed) == 0;
+          }),
+      m_rings.end());
+}
+
+void AsyncLogWriter::runDrainer() {
+  pthread_setname_np(pthread_self(), "RNOH_LOGGER");
+  while (true) {
+    {
+      std::unique_lock lock(m_mtx);
+      m_cv.wait_for(lock, DRAIN_INTERVAL);
+    }
+    drain();
+  }
+}
+
+} // namespace rnoh
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <hilog/log.h>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * @internal
+ * @ThreadSafe
+ *
+ * Moves hilog writes off the threads that log. Every logging thread appends
+ * formatted lines to its own single-producer ring buffer without taking any
+ * lock, and a background thread drains all buffers into hilog. When a buffer
+ * is full, the line is dropped and the drop is reported later, so that
+ * logging never blocks the thread that logs. Lines keep their order per
+ * thread, but hilog timestamps them when they're drained.
+ */
+class AsyncLogWriter {
+ public:
+  static constexpr size_t MAX_LINE_LENGTH = 1024 - sizeof(size_t) * 2;
+
+  static AsyncLogWriter& getInstance();
+
+  /**
+   * Queues the line made of concatenated `parts`. Returns false if the line
+   * is longer than MAX_LINE_LENGTH; such lines should be written
+   * synchronously.
+   */
+  bool write(
+      LogLevel level,
+      const char* tag,
+      std::initializer_list<std::string_view> parts);
+
+  /**
+   * Writes all queued lines to hilog before returning.
+   */
+  void flush();
+
+ private:
+  static constexpr size_t RING_CAPACITY = 128;
+
+  struct Line {
+    LogLevel level;
+    const char* tag;
+    size_t length;
+    std::array<char, MAX_LINE_LENGTH + 1> text;
+  };
+
+  /**
+   * Written only by the owning thread and read only by the drainer.
+   */
+  struct Ring {
+    std::array<Line, RING_CAPACITY> lines;
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+    std::atomic<size_t> droppedLinesCount{0};
+  };
+
+  AsyncLogWriter();
+
+  std::shared_ptr<Ring> const& getThreadRing();
+  void drain();
+  void runDrainer();
+
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<std::shared_ptr<Ring>> m_rings;
+  std::mutex m_drainMtx;
+  std::thread m_drainerThread;
+};
+
+} // namespace rnoh
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "BlobStore.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace rnoh {
+
+/**
+ * Blob memory, kept in a memory file when it is large, so that it can be
+ * mapped copy-on-write.
+ */
+class BlobStore::Memory {
+ public:
+  explicit Memory(size_t size) {
+    if (size >= MIN_MAPPED_BLOB_SIZE && mapMemoryFile(size)) {
+      return;
+    }
+    // empty blobs still get a valid pointer
+    m_heapData = std::make_unique<uint8_t[]>(std::max<size_t>(size, 1));
+    m_data = m_heapData.get();
+  }
+
+  Memory(Memory const&) = delete;
+  Memory& operator=(Memory const&) = delete;
+
+  ~Memory() {
+    if (m_fd >= 0) {
+      munmap(m_data, m_size);
+      close(m_fd);
+    }
+  }
+
+  uint8_t* data() {
+    return m_data;
+  }
+
+  PrivateCopy createPrivateCopy(uint8_t const* data, size_t size) const {
+    PrivateCopy privateCopy;
+    privateCopy.m_size = size;
+    if (m_fd >= 0 && size >= MIN_MAPPED_BLOB_SIZE) {
+      // mappings start at a page boundary
+      static auto const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      auto offset = static_cast<size_t>(data - m_data);
+      auto mappingOffset = offset - offset % pageSize;
+      auto mappingSize = offset - mappingOffset + size;
+      auto mapping = mmap(
+          nullptr,
+          mappingSize,
+          PROT_READ | PROT_WRITE,
+          MAP_PRIVATE,
+          m_fd,
+          static_cast<off_t>(mappingOffset));
+      if (mapping != MAP_FAILED) {
+        privateCopy.m_mapping = mapping;
+        privateCopy.m_mappingSize = mappingSize;
+        privateCopy.m_data =
+            static_cast<uint8_t*>(mapping) + (offset - mappingOffset);
+        return privateCopy;
+      }
+    }
+    privateCopy.m_copy =
+        std::make_unique<uint8_t[]>(std::max<size_t>(size, 1));
+    privateCopy.m_data = privateCopy.m_copy.get();
+    if (size > 0) {
+      std::memcpy(privateCopy.m_data, data, size);
+    }
+    return privateCopy;
+  }
+
+ private:
+  bool mapMemoryFile(size_t size) {
+    auto fd = memfd_create("rnoh_blob", MFD_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+    void* mapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+      mapping =
+          mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (mapping == MAP_FAILED) {
+      // e.g. when out of file descriptors; the blob is kept on the heap
+      close(fd);
+      return false;
+    }
+    m_fd = fd;
+    m_data = static_cast<uint8_t*>(mapping);
+    m_size = size;
+    return true;
+  }
+
+  std::unique_ptr<uint8_t[]> m_heapData;
+  int m_fd = -1;
+  uint8_t* m_data = nullptr;
+  size_t m_size = 0;
+};
+
+BlobStore::PrivateCopy::PrivateCopy(PrivateCopy&& other) noexcept {
+  *this = std::move(other);
+}
+
+BlobStore::PrivateCopy& BlobStore::PrivateCopy::operator=(
+    PrivateCopy&& other) noexcept {
+  if (this != &other) {
+    reset();
+    m_copy = std::move(other.m_copy);
+    m_mapping = std::exchange(other.m_mapping, nullptr);
+    m_mappingSize = std::exchange(other.m_mappingSize, 0);
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+  }
+  return *this;
+}
+
+BlobStore::PrivateCopy::~PrivateCopy() {
+  reset();
+}
+
+void BlobStore::PrivateCopy::reset() {
+  if (m_mapping != nullptr) {
+    munmap(m_mapping, m_mappingSize);
+    m_mapping = nullptr;
+  }
+  m_copy.reset();
+}
+
+BlobStore::Blob BlobStore::Blob::slice(
+    size_t offset,
+    std::optional<size_t> size) const {
+  offset = std::min(offset, m_size);
+  auto sliceSize = std::min(size.value_or(m_size - offset), m_size - offset);
+  return {m_memory, m_data + offset, sliceSize};
+}
+
+BlobStore::PrivateCopy BlobStore::Blob::createPrivateCopy() const {
+  if (m_memory == nullptr) {
+    return Memory(0).createPrivateCopy(nullptr, 0);
+  }
+  return m_memory->createPrivateCopy(m_data, m_size);
+}
+
+BlobStore& BlobStore::getInstance() {
+  // never destroyed, so that ArrayBuffers finalized during static
+  // destruction don't outlive it
+  static auto instance = new BlobStore();
+  return *instance;
+}
+
+std::shared_ptr<BlobStore::Memory> BlobStore::allocateMemory(size_t size) {
+  return std::make_shared<Memory>(size);
+}
+
+uint8_t* BlobStore::allocate(std::string blobId, size_t size) {
+  auto memory = allocateMemory(size);
+  auto data = memory->data();
+  std::lock_guard lock(m_mtx);
+  m_blobById.insert_or_assign(std::move(blobId), Blob(memory, data, size));
+  return data;
+}
+
+void BlobStore::save(std::string blobId, uint8_t const* data, size_t size) {
+  auto memory = allocateMemory(size);
+  if (size > 0) {
+    std::memcpy(memory->data(), data, size);
+  }
+  std::lock_guard lock(m_mtx);
+  m_blobById.insert_or_assign(
+      std::move(blobId), Blob(memory, memory->data(), size));
+}
+
+void BlobStore::createFromParts(
+    std::string blobId,
+    std::vector<Part> const& parts) {
+  std::vector<Blob> blobParts;
+  blobParts.reserve(parts.size());
+  {
+    std::lock_guard lock(m_mtx);
+    for (auto const& part : parts) {
+      if (std::holds_alternative<std::string>(part)) {
+        continue;
+      }
+      auto const& blobSlice = std::get<BlobSlice>(part);
+      auto it = m_blobById.find(blobSlice.blobId);
+      if (it == m_blobById.end()) {
+        throw std::runtime_error(
+            "Blob with id " + blobSlice.blobId + " doesn't exist");
+      }
+      blobParts.push_back(it->second.slice(blobSlice.offset, blobSlice.size));
+    }
+  }
+  Blob blob;
+  if (parts.size() == 1 && blobParts.size() == 1) {
+    blob = std::move(blobParts.front());
+  } else {
+    size_t size = 0;
+    auto blobPartIt = blobParts.begin();
+    for (auto const& part : parts) {
+      auto text = std::get_if<std::string>(&part);
+      size += text != nullptr ? text->size() : (blobPartIt++)->size();
+    }
+    auto memory = allocateMemory(size);
+    auto dest = memory->data();
+    blobPartIt = blobParts.begin();
+    for (auto const& part : parts) {
+      auto text = std::get_if<std::string>(&part);
+      auto src = text != nullptr
+          ? reinterpret_cast<uint8_t const*>(text->data())
+          : blobPartIt->data();
+      auto srcSize = text != nullptr ? text->size() : (blobPartIt++)->size();
+      if (srcSize > 0) {
+        std::memcpy(dest, src, srcSize);
+      }
+      dest += srcSize;
+    }
+    blob = Blob(memory, memory->data(), size);
+  }
+  std::lock_guard lock(m_mtx);
+  m_blobById.insert_or_assign(std::move(blobId), std::move(blob));
+}
+
+std::optional<BlobStore::Blob> BlobStore::find(
+    std::string const& blobId,
+    size_t offset,
+    std::optional<size_t> size) const {
+  std::lock_guard lock(m_mtx);
+  auto it = m_blobById.find(blobId);
+  if (it == m_blobById.end()) {
+    return std::nullopt;
+  }
+  return it->second.slice(offset, size);
+}
+
+void BlobStore::release(std::string const& blobId) {
+  Blob blob;
+  {
+    std::lock_guard lock(m_mtx);
+    auto it = m_blobById.find(blobId);
+    if (it == m_blobById.end()) {
+      return;
+    }
+    blob = std::move(it->second);
+    m_blobById.erase(it);
+  }
+  // the memory, if this was its last reference, is freed outside the lock
+}
+
+} // namespace rnoh
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * @internal
+ * @ThreadSafe
+ *
+ * Owns the contents of JS Blobs. Blob memory is reference counted: the store
+ * holds one reference per blob id, and slices and ArrayBuffers created from
+ * a blob hold their own, so releasing a blob id never invalidates memory
+ * that is still in use. Slicing doesn't copy. Blob ids are UUIDs generated
+ * by JS or ArkTS, so one store is shared by all RN instances.
+ *
+ * Blobs are immutable once their id is handed out, but JS and ArkTS may
+ * write to the ArrayBuffers they get. Such ArrayBuffers are backed by
+ * private copies: large blobs are kept in a memory file, which is mapped
+ * copy-on-write for every copy, so that only the pages that are written get
+ * copied; smaller blobs are simply copied.
+ */
+class BlobStore {
+ public:
+  /**
+   * Blobs at least this large are kept in a memory file.
+   */
+  static constexpr size_t MIN_MAPPED_BLOB_SIZE = 64 * 1024;
+
+  class Memory;
+
+  /**
+   * Writable memory holding the contents of a blob view, which doesn't
+   * affect the blob when written.
+   */
+  class PrivateCopy {
+   public:
+    PrivateCopy(PrivateCopy&& other) noexcept;
+    PrivateCopy& operator=(PrivateCopy&& other) noexcept;
+    PrivateCopy(PrivateCopy const&) = delete;
+    PrivateCopy& operator=(PrivateCopy const&) = delete;
+    ~PrivateCopy();
+
+    uint8_t* data() {
+      return m_data;
+    }
+
+    size_t size() const {
+      return m_size;
+    }
+
+   private:
+    friend class BlobStore;
+
+    PrivateCopy() = default;
+
+    void reset();
+
+    std::unique_ptr<uint8_t[]> m_copy;
+    void* m_mapping = nullptr;
+    size_t m_mappingSize = 0;
+    uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+  };
+
+  /**
+   * A read-only view of blob memory, which keeps the memory alive.
+   */
+  class Blob {
+   public:
+    Blob() = default;
+
+    uint8_t const* data() const {
+      return m_data;
+    }
+
+    size_t size() const {
+      return m_size;
+    }
+
+    /**
+     * Returns a view of `size` bytes starting at `offset`, or of the rest of
+     * the blob when `size` is not provided. Out of range values are clamped.
+     */
+    Blob slice(size_t offset, std::optional<size_t> size = std::nullopt)
+        const;
+
+    PrivateCopy createPrivateCopy() const;
+
+   private:
+    friend class BlobStore;
+
+    Blob(std::shared_ptr<Memory> memory, uint8_t const* data, size_t size)
+        : m_memory(std::move(memory)), m_data(data), m_size(size) {}
+
+    std::shared_ptr<Memory> m_memory;
+    uint8_t const* m_data = nullptr;
+    size_t m_size = 0;
+  };
+
+  struct BlobSlice {
+    std::string blobId;
+    size_t offset;
+    size_t size;
+  };
+
+  /**
+   * Text parts are stored as UTF-8.
+   */
+  using Part = std::variant<std::string, BlobSlice>;
+
+  static BlobStore& getInstance();
+
+  /**
+   * Stores a blob of `size` uninitialized bytes and returns its memory, so
+   * that the caller can fill it in place. The blob must be filled before its
+   * id is handed to anyone else.
+   */
+  uint8_t* allocate(std::string blobId, size_t size);
+
+  void save(std::string blobId, uint8_t const* data, size_t size);
+
+  /**
+   * A blob made of a single blob part shares that blob's memory; otherwise
+   * parts are copied into new memory once. Throws if a part refers to a
+   * blob that doesn't exist.
+   */
+  void createFromParts(std::string blobId, std::vector<Part> const& parts);
+
+  std::optional<Blob> find(
+      std::string const& blobId,
+      size_t offset = 0,
+      std::optional<size_t> size = std::nullopt) const;
+
+  void release(std::string const& blobId);
+
+ private:
+  BlobStore() = default;
+
+  static std::shared_ptr<Memory> allocateMemory(size_t size);
+
+  mutable std::mutex m_mtx;
+  std::unordered_map<std::string, Blob> m_blobById;
+};
+
+} // namespace rnoh
@@ -34,6 +34,7 @@ void ComponentInstance::insertChild(
   onChildInserted(childComponentInstance, newIndex);
   childComponentInstance->setIndex(index);
   m_children.insert(it, std::move(childComponentInstance));
+  m_touchTargetChildrenIndex.invalidate();
 }
 
 void ComponentInstance::removeChild(
@@ -43,8 +44,23 @@ void ComponentInstance::removeChild(
   if (it != m_children.end()) {
     auto childComponentInstance = std::move(*it);
     m_children.erase(it);
+    m_touchTargetChildrenIndex.invalidate();
     onChildRemoved(childComponentInstance);
   }
 }
 
+void ComponentInstance::prepareForRecycle() {
+  m_parent.reset();
+  m_index = 0;
+  m_children.clear();
+  m_touchTargetChildrenIndex.invalidate();
+  m_nativeResponderBlockOrigins.clear();
+  m_ignoredPropKeys.clear();
+  onRecycle();
+}
+
+void ComponentInstance::prepareForReuse(Tag tag) {
+  m_tag = tag;
+}
+
 } // namespace rnoh
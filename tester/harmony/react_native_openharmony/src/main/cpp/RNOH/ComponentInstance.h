@@ -16,10 +16,12 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/State.h>
 #include <vector>
+#include "RNOH/AnimatedProps.h"
 #include "RNOH/ArkTSChannel.h"
 #include "RNOH/ArkTSMessageHub.h"
 #include "RNOH/RNInstance.h"
 #include "RNOH/TouchTarget.h"
+#include "RNOH/TouchTargetChildrenIndex.h"
 #include "RNOH/arkui/ArkUINode.h"
 #include "RNOH/arkui/UIInputEventHandler.h"
 #include "RNOH/ArkTSTurboModule.h"
@@ -125,6 +127,29 @@ class ComponentInstance
    */
   void removeChild(ComponentInstance::Shared childComponentInstance);
 
+  /**
+   * @internal
+   * Whether this instance and its ArkUI node can be kept in the
+   * ComponentInstancePool after it was deleted and reused for a new tag.
+   * Subclasses returning true must reset all tag-specific state in
+   * `onRecycle`.
+   */
+  virtual bool isRecyclable() const {
+    return false;
+  }
+
+  /**
+   * @internal
+   * Detaches a deleted instance from the component tree before it's put into
+   * the ComponentInstancePool.
+   */
+  void prepareForRecycle();
+
+  /**
+   * @internal
+   */
+  void prepareForReuse(Tag tag);
+
   virtual facebook::react::Props::Shared getProps() const = 0;
   
     
@@ -274,6 +299,38 @@ class ComponentInstance
     return m_ignoredPropKeys;
   }
 
+  /**
+   * @internal
+   */
+  void addIgnoredPropKey(std::string const& propKey) {
+    m_ignoredPropKeys.insert(propKey);
+  }
+
+  /**
+   * @internal
+   * Called when the bounding box of a child changes.
+   */
+  void invalidateTouchTargetChildrenIndex() {
+    m_touchTargetChildrenIndex.invalidate();
+  }
+
+  /**
+   * @internal
+   * Called when the layout frame of a direct child changes. Not called for
+   * transforms or for changes deeper in the subtree.
+   */
+  virtual void onChildFrameChanged() {}
+
+  /**
+   * @internal
+   * Applies values computed by native Animated directly to the ArkUI node,
+   * without cloning props. Returns false if the component can't apply some
+   * of them this way; the caller falls back to updating RawProps then.
+   */
+  virtual bool setAnimatedProps(AnimatedProps const& animatedProps) {
+    return false;
+  }
+
   virtual bool isRefreshControlComponentInstance() const {
     return false;
   }
@@ -288,6 +345,13 @@ class ComponentInstance
 
   virtual void onFinalizeUpdates() {}
 
+  /**
+   * Called when a deleted instance is put into the ComponentInstancePool.
+   * Props are kept, so the next `setProps` only updates attributes that
+   * differ between the deleted and the created component.
+   */
+  virtual void onRecycle() {}
+
   virtual void onCommandReceived(
       std::string const& commandName,
       folly::dynamic const& args) {}
@@ -307,6 +371,7 @@ class ComponentInstance
   float m_oldPointScaleFactor = 0.0f;
   ComponentHandle m_componentHandle;
   std::vector<ComponentInstance::Shared> m_children;
+  TouchTargetChildrenIndex m_touchTargetChildrenIndex;
   ComponentInstance::Weak m_parent;
   std::size_t m_index = 0;
   facebook::react::BorderMetrics m_oldBorderMetrics;
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "ComponentInstancePool.h"
+
+namespace rnoh {
+
+void ComponentInstancePool::addSurface(facebook::react::SurfaceId surfaceId) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_poolBySurfaceId.try_emplace(surfaceId);
+}
+
+bool ComponentInstancePool::release(
+    facebook::react::SurfaceId surfaceId,
+    ComponentInstance::Shared componentInstance) {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  // the surface was destroyed, or never created
+  auto surfacePoolIt = m_poolBySurfaceId.find(surfaceId);
+  if (surfacePoolIt == m_poolBySurfaceId.end()) {
+    return false;
+  }
+  auto& surfacePool = surfacePoolIt->second;
+  if (surfacePool.size >= surfacePool.capacity) {
+    return false;
+  }
+  auto componentHandle = componentInstance->getComponentHandle();
+  surfacePool.componentInstancesByHandle[componentHandle].push_back(
+      std::move(componentInstance));
+  surfacePool.size++;
+  return true;
+}
+
+ComponentInstance::Shared ComponentInstancePool::acquire(
+    facebook::react::SurfaceId surfaceId,
+    facebook::react::Tag tag,
+    facebook::react::ComponentHandle componentHandle) {
+  ComponentInstance::Shared componentInstance = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto surfacePoolIt = m_poolBySurfaceId.find(surfaceId);
+    if (surfacePoolIt == m_poolBySurfaceId.end()) {
+      return nullptr;
+    }
+    auto& surfacePool = surfacePoolIt->second;
+    auto componentInstancesIt =
+        surfacePool.componentInstancesByHandle.find(componentHandle);
+    if (componentInstancesIt ==
+            surfacePool.componentInstancesByHandle.end() ||
+        componentInstancesIt->second.empty()) {
+      return nullptr;
+    }
+    componentInstance = std::move(componentInstancesIt->second.back());
+    componentInstancesIt->second.pop_back();
+    surfacePool.size--;
+  }
+  componentInstance->prepareForReuse(tag);
+  return componentInstance;
+}
+
+bool ComponentInstancePool::setCapacity(
+    facebook::react::SurfaceId surfaceId,
+    size_t capacity) {
+  std::vector<ComponentInstance::Shared> evictedComponentInstances;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto surfacePoolIt = m_poolBySurfaceId.find(surfaceId);
+    if (surfacePoolIt == m_poolBySurfaceId.end()) {
+      return false;
+    }
+    auto& surfacePool = surfacePoolIt->second;
+    surfacePool.capacity = capacity;
+    for (auto& [_, componentInstances] :
+         surfacePool.componentInstancesByHandle) {
+      while (surfacePool.size > capacity && !componentInstances.empty()) {
+        evictedComponentInstances.push_back(
+            std::move(componentInstances.back()));
+        componentInstances.pop_back();
+        surfacePool.size--;
+      }
+    }
+  }
+  // instances (and their ArkUI nodes) are destroyed outside of the lock
+  return true;
+}
+
+void ComponentInstancePool::clear(facebook::react::SurfaceId surfaceId) {
+  SurfacePool surfacePool;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto surfacePoolIt = m_poolBySurfaceId.find(surfaceId);
+    if (surfacePoolIt == m_poolBySurfaceId.end()) {
+      return;
+    }
+    surfacePool = std::move(surfacePoolIt->second);
+    m_poolBySurfaceId.erase(surfacePoolIt);
+  }
+}
+
+void ComponentInstancePool::clear() {
+  std::unordered_map<facebook::react::SurfaceId, SurfacePool> poolBySurfaceId;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    poolBySurfaceId = std::move(m_poolBySurfaceId);
+    m_poolBySurfaceId.clear();
+  }
+}
+
+} // namespace rnoh
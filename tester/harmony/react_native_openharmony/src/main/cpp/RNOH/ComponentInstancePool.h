@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <react/renderer/core/ReactPrimitives.h>
+#include "RNOH/ComponentInstance.h"
+
+namespace rnoh {
+/**
+ * @internal
+ * @ThreadSafe
+ *
+ * Keeps ComponentInstances released by DELETE mutations, together with their
+ * ArkUI nodes, so that CREATE mutations of the same ComponentHandle on the
+ * same surface can reuse them instead of creating new nodes. Released
+ * instances are detached from the tree and are only touched again by the
+ * thread that acquires them.
+ */
+class ComponentInstancePool {
+ public:
+  using Shared = std::shared_ptr<ComponentInstancePool>;
+
+  static constexpr size_t DEFAULT_CAPACITY_PER_SURFACE = 32;
+
+  /**
+   * Creates the pool of a surface. Instances are only kept for surfaces
+   * which have a pool, i.e. between `addSurface` and `clear(surfaceId)`.
+   */
+  void addSurface(facebook::react::SurfaceId surfaceId);
+
+  /**
+   * Takes ownership of `componentInstance` if the surface has a pool with
+   * room left. Returns false if the instance was rejected and should be
+   * destroyed.
+   */
+  bool release(
+      facebook::react::SurfaceId surfaceId,
+      ComponentInstance::Shared componentInstance);
+
+  /**
+   * Returns a recycled instance retagged with `tag`, or nullptr if there is
+   * no instance of `componentHandle` in the pool of the surface.
+   */
+  ComponentInstance::Shared acquire(
+      facebook::react::SurfaceId surfaceId,
+      facebook::react::Tag tag,
+      facebook::react::ComponentHandle componentHandle);
+
+  /**
+   * Limits how many instances the surface keeps in total. 0 disables
+   * recycling for the surface. Returns false if the surface has no pool.
+   */
+  bool setCapacity(facebook::react::SurfaceId surfaceId, size_t capacity);
+
+  /**
+   * Destroys the pool of the surface and the instances it kept.
+   */
+  void clear(facebook::react::SurfaceId surfaceId);
+
+  void clear();
+
+ private:
+  struct SurfacePool {
+    size_t capacity = DEFAULT_CAPACITY_PER_SURFACE;
+    size_t size = 0;
+    std::unordered_map<
+        facebook::react::ComponentHandle,
+        std::vector<ComponentInstance::Shared>>
+        componentInstancesByHandle;
+  };
+
+  std::mutex m_mtx;
+  std::unordered_map<facebook::react::SurfaceId, SurfacePool>
+      m_poolBySurfaceId;
+};
+} // namespace rnoh
@@ -12,13 +12,18 @@
 #include "RNOH/ParallelComponent.h"
 #include "RNOH/ParallelCheck.h"
 #include "RNOH/FFRTConfig.h"
+#include "RNOH/MutationCostModel.h"
 
 namespace rnoh {
 
 void ComponentInstancePreallocationRequestQueue::push(const Request& request) {
   if (!IsParallelizationWorkable()) {
+    auto estimatedCost = std::chrono::microseconds(
+        MutationCostModel::getInstance().estimateCreateCostUs(
+            request.componentHandle));
     auto lock = std::lock_guard(m_mtx);
-    m_queue.push(std::move(request));
+    m_requestsBySurfaceId[request.surfaceId].insert(
+        QueuedRequest{request, estimatedCost, m_nextSequenceNumber++});
   }
   auto delegate = m_weakDelegate.lock();
   if (delegate != nullptr) {
@@ -41,20 +46,89 @@ void ComponentInstancePreallocationRequestQueue::push(const Request& request) {
 
 bool ComponentInstancePreallocationRequestQueue::isEmpty() {
   auto lock = std::lock_guard(m_mtx);
-  return m_queue.empty();
+  return m_requestsBySurfaceId.empty();
 }
 
 auto ComponentInstancePreallocationRequestQueue::pop()
     -> std::optional<Request> {
   auto lock = std::lock_guard(m_mtx);
-  if (!m_queue.empty()) {
-    auto request = m_queue.front();
-    m_queue.pop();
-    return request;
+  return popLocked(std::nullopt);
+}
+
+auto ComponentInstancePreallocationRequestQueue::pop(
+    std::chrono::nanoseconds timeLeft) -> std::optional<Request> {
+  auto lock = std::lock_guard(m_mtx);
+  return popLocked(timeLeft);
+}
+
+auto ComponentInstancePreallocationRequestQueue::popLocked(
+    std::optional<std::chrono::nanoseconds> maxCost)
+    -> std::optional<Request> {
+  QueuedRequestComparator isMoreImportant;
+  for (bool isVisible : {true, false}) {
+    std::optional<decltype(m_requestsBySurfaceId)::iterator> bestSurfaceIt;
+    SurfaceRequests::iterator bestRequestIt;
+    for (auto surfaceIt = m_requestsBySurfaceId.begin();
+         surfaceIt != m_requestsBySurfaceId.end();
+         ++surfaceIt) {
+      if ((m_hiddenSurfaceIds.count(surfaceIt->first) == 0) != isVisible) {
+        continue;
+      }
+      auto& requests = surfaceIt->second;
+      // requests are ordered by descending cost, so the first one that fits
+      // is the most important one that fits
+      auto requestIt = maxCost.has_value() ? requests.lower_bound(*maxCost)
+                                           : requests.begin();
+      if (requestIt == requests.end()) {
+        continue;
+      }
+      if (!bestSurfaceIt.has_value() ||
+          isMoreImportant(*requestIt, *bestRequestIt)) {
+        bestSurfaceIt = surfaceIt;
+        bestRequestIt = requestIt;
+      }
+    }
+    if (bestSurfaceIt.has_value()) {
+      auto& requests = (*bestSurfaceIt)->second;
+      auto request = requests.extract(bestRequestIt).value().request;
+      if (requests.empty()) {
+        m_requestsBySurfaceId.erase(*bestSurfaceIt);
+      }
+      return request;
+    }
   }
   return std::nullopt;
 }
 
+void ComponentInstancePreallocationRequestQueue::setSurfaceVisible(
+    facebook::react::SurfaceId surfaceId,
+    bool isVisible) {
+  auto lock = std::lock_guard(m_mtx);
+  if (isVisible) {
+    m_hiddenSurfaceIds.erase(surfaceId);
+  } else {
+    m_hiddenSurfaceIds.insert(surfaceId);
+  }
+}
+
+bool ComponentInstancePreallocationRequestQueue::QueuedRequestComparator::
+operator()(QueuedRequest const& lhs, QueuedRequest const& rhs) const {
+  if (lhs.estimatedCost != rhs.estimatedCost) {
+    return lhs.estimatedCost > rhs.estimatedCost;
+  }
+  return lhs.sequenceNumber < rhs.sequenceNumber;
+}
+
+bool ComponentInstancePreallocationRequestQueue::QueuedRequestComparator::
+operator()(QueuedRequest const& lhs, std::chrono::nanoseconds rhs) const {
+  return lhs.estimatedCost > rhs;
+}
+
+bool ComponentInstancePreallocationRequestQueue::QueuedRequestComparator::
+operator()(std::chrono::nanoseconds lhs, QueuedRequest const& rhs) const {
+  return lhs > rhs.estimatedCost;
+}
+
 void ComponentInstancePreallocationRequestQueue::setDelegate(
     Delegate::Weak weakDelegate) {
   m_weakDelegate = weakDelegate;
@@ -62,7 +136,7 @@ void ComponentInstancePreallocationRequestQueue::setDelegate(
 
 void ComponentInstancePreallocationRequestQueue::clear() {
   auto lock = std::lock_guard(m_mtx);
-  m_queue = {};
+  m_requestsBySurfaceId.clear();
 }
 
 } // namespace rnoh
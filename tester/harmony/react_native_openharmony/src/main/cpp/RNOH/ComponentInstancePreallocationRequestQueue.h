@@ -8,8 +8,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "react/renderer/mounting/ShadowView.h"
 
 namespace rnoh {
@@ -17,6 +22,12 @@ namespace rnoh {
 /**
  * @internal
  * @threadSafe
+ *
+ * Requests are popped in priority order: requests for visible surfaces
+ * first, then the ones expected to be most expensive to create (according
+ * to MutationCostModel), then in the order they were pushed. Visibility is
+ * checked when popping, so showing or hiding a surface reorders the requests
+ * already queued for it.
  */
 class ComponentInstancePreallocationRequestQueue {
  public:
@@ -25,6 +36,7 @@ class ComponentInstancePreallocationRequestQueue {
     facebook::react::ComponentHandle componentHandle;
     facebook::react::ComponentName componentName;
     facebook::react::Props::Shared props;
+    facebook::react::SurfaceId surfaceId;
   };
   class Delegate {
     friend ComponentInstancePreallocationRequestQueue;
@@ -41,7 +53,43 @@ class ComponentInstancePreallocationRequestQueue {
   using Weak = std::weak_ptr<ComponentInstancePreallocationRequestQueue>;
 
  private:
-  std::queue<Request> m_queue;
+  struct QueuedRequest {
+    Request request;
+    std::chrono::microseconds estimatedCost;
+    uint64_t sequenceNumber;
+  };
+
+  /**
+   * Orders the requests of a surface from the most to the least important.
+   * Comparing with a duration finds the requests expected to fit into it.
+   */
+  struct QueuedRequestComparator {
+    using is_transparent = void;
+
+    bool operator()(QueuedRequest const& lhs, QueuedRequest const& rhs) const;
+    bool operator()(
+        QueuedRequest const& lhs,
+        std::chrono::nanoseconds rhs) const;
+    bool operator()(
+        std::chrono::nanoseconds lhs,
+        QueuedRequest const& rhs) const;
+  };
+
+  using SurfaceRequests = std::set<QueuedRequest, QueuedRequestComparator>;
+
+  /**
+   * Pops the most important request expected to be created within
+   * `maxCost`, preferring visible surfaces. Visibility is checked here rather
+   * than on push, as surfaces may be shown or hidden while requests wait.
+   */
+  std::optional<Request> popLocked(
+      std::optional<std::chrono::nanoseconds> maxCost);
+
+  // surfaces without requests are removed
+  std::unordered_map<facebook::react::SurfaceId, SurfaceRequests>
+      m_requestsBySurfaceId;
+  std::unordered_set<facebook::react::SurfaceId> m_hiddenSurfaceIds;
+  uint64_t m_nextSequenceNumber = 0;
   std::mutex m_mtx;
   Delegate::Weak m_weakDelegate;
 
@@ -53,6 +101,18 @@ class ComponentInstancePreallocationRequestQueue {
 
   std::optional<Request> pop();
 
+  /**
+   * Pops the most important request among the ones expected to be created
+   * within `timeLeft`.
+   */
+  std::optional<Request> pop(std::chrono::nanoseconds timeLeft);
+
+  /**
+   * Requests for hidden surfaces are processed after all requests for
+   * visible ones.
+   */
+  void setSurfaceVisible(facebook::react::SurfaceId surfaceId, bool isVisible);
+
   void clear();
 
   bool isEmpty();
@@ -64,6 +64,7 @@ void ComponentInstanceProvider::onPushPreallocationRequest() {
 }
 
 ComponentInstance::Shared ComponentInstanceProvider::getComponentInstance(
+    facebook::react::SurfaceId surfaceId,
     facebook::react::Tag tag,
     facebook::react::ComponentHandle componentHandle,
     std::string componentName) {
@@ -77,8 +78,17 @@ ComponentInstance::Shared ComponentInstanceProvider::getComponentInstance(
   if (!isComponentInstanceNotHit) {
     return componentInstanceIt->second;
   }
-  auto componentInstance = m_componentInstanceFactory->create(
-      tag, componentHandle, std::move(componentName));
+  // pooled instances were created and mounted on MAIN, so their ArkUI nodes
+  // must not be handed to the workers creating subtrees in parallel
+  ComponentInstance::Shared componentInstance = nullptr;
+  if (m_threadGuard.isCurrentThread()) {
+    componentInstance =
+        m_componentInstancePool.acquire(surfaceId, tag, componentHandle);
+  }
+  if (componentInstance == nullptr) {
+    componentInstance = m_componentInstanceFactory->create(
+        tag, componentHandle, std::move(componentName));
+  }
   m_preallocatedComponentInstanceByTag.emplace(tag, componentInstance);
   return componentInstance;
 }
@@ -114,6 +124,37 @@ void rnoh::ComponentInstanceProvider::clearPreallocatedViews() {
   m_preallocatedComponentInstanceByTag.clear();
 }
 
+bool ComponentInstanceProvider::recycleComponentInstance(
+    facebook::react::SurfaceId surfaceId,
+    ComponentInstance::Shared componentInstance) {
+  m_threadGuard.assertThread();
+  if (!componentInstance->isRecyclable()) {
+    return false;
+  }
+  componentInstance->prepareForRecycle();
+  return m_componentInstancePool.release(
+      surfaceId, std::move(componentInstance));
+}
+
+void ComponentInstanceProvider::createComponentInstancePool(
+    facebook::react::SurfaceId surfaceId) {
+  m_threadGuard.assertThread();
+  m_componentInstancePool.addSurface(surfaceId);
+}
+
+bool ComponentInstanceProvider::setComponentInstancePoolCapacity(
+    facebook::react::SurfaceId surfaceId,
+    size_t capacity) {
+  m_threadGuard.assertThread();
+  return m_componentInstancePool.setCapacity(surfaceId, capacity);
+}
+
+void ComponentInstanceProvider::clearComponentInstancePool(
+    facebook::react::SurfaceId surfaceId) {
+  m_threadGuard.assertThread();
+  m_componentInstancePool.clear(surfaceId);
+}
+
 void ComponentInstanceProvider::onUITick(
     UITicker::Timestamp recentVSyncTimestamp) {
   facebook::react::SystraceSection s("ComponentInstanceProvider::onUITick");
@@ -126,18 +167,16 @@ void ComponentInstanceProvider::onUITick(
     }
     return;
   }
-  while (true) {
-    if (this->shouldPausePreallocationToAvoidBlockingMainThread(
-            recentVSyncTimestamp)) {
-      VLOG(2) << "Pausing preallocation to avoid blocking main thread";
-      break;
-    }
-    auto maybeRequest = m_preallocationRequestQueue->pop();
-
-    if (!maybeRequest.has_value()) {
-      break;
-    }
+  // at least one request is processed per frame, so that preallocation makes
+  // progress even if ticks are delivered late on a busy main thread
+  auto maybeRequest = m_preallocationRequestQueue->pop();
+  while (maybeRequest.has_value()) {
     processPreallocationRequest(maybeRequest.value());
+    maybeRequest = m_preallocationRequestQueue->pop(
+        getPreallocationTimeLeftInFrame(recentVSyncTimestamp));
+  }
+  if (!m_preallocationRequestQueue->isEmpty()) {
+    VLOG(2) << "Pausing preallocation to avoid blocking main thread";
   }
 }
 
@@ -160,14 +199,13 @@ void ComponentInstanceProvider::processPreallocationRequest(
   }
 }
 
-bool ComponentInstanceProvider::
-    shouldPausePreallocationToAvoidBlockingMainThread(
-        UITicker::Timestamp recentVSyncTimestamp) {
-  constexpr int FPS = 120;
-  static constexpr auto FRAME_DURATION =
-      std::chrono::nanoseconds(1000000000 / FPS);
+std::chrono::nanoseconds
+ComponentInstanceProvider::getPreallocationTimeLeftInFrame(
+    UITicker::Timestamp recentVSyncTimestamp) {
+  // the rest of the frame is left for mounting and ArkUI's layout and render
+  constexpr int PREALLOCATION_FRAME_BUDGET_DIVISOR = 2;
   m_threadGuard.assertThread();
-  auto timeLeftInFrame = FRAME_DURATION -
-      (std::chrono::steady_clock::now() - recentVSyncTimestamp);
-  return timeLeftInFrame < (FRAME_DURATION / 2);
+  auto frameBudget =
+      m_uiTicker->getVsyncPeriod() / PREALLOCATION_FRAME_BUDGET_DIVISOR;
+  return frameBudget - (std::chrono::steady_clock::now() - recentVSyncTimestamp);
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "ComponentInstanceFactory.h"
+#include "ComponentInstancePool.h"
 #include "ComponentInstancePreallocationRequestQueue.h"
 #include "ComponentInstanceRegistry.h"
 #include "UITicker.h"
@@ -28,6 +29,7 @@ class ComponentInstanceProvider
   ComponentInstancePreallocationRequestQueue::Shared
       m_preallocationRequestQueue;
   ComponentInstanceRegistry::Shared m_componentInstanceRegistry;
+  ComponentInstancePool m_componentInstancePool;
   ThreadGuard m_threadGuard;
   UITicker::Shared m_uiTicker;
   TaskExecutor::Weak m_weakTaskExecutor;
@@ -49,6 +51,7 @@ class ComponentInstanceProvider
   void initialize();
 
   ComponentInstance::Shared getComponentInstance(
+      facebook::react::SurfaceId surfaceId,
       facebook::react::Tag tag,
       facebook::react::ComponentHandle componentHandle,
       std::string componentName);
@@ -66,6 +69,22 @@ class ComponentInstanceProvider
 
   void clearPreallocatedViews();
 
+  /**
+   * Offers a deleted instance to the pool of the surface. Returns false if
+   * the instance can't be recycled and will be destroyed.
+   */
+  bool recycleComponentInstance(
+      facebook::react::SurfaceId surfaceId,
+      ComponentInstance::Shared componentInstance);
+
+  void createComponentInstancePool(facebook::react::SurfaceId surfaceId);
+
+  bool setComponentInstancePoolCapacity(
+      facebook::react::SurfaceId surfaceId,
+      size_t capacity);
+
+  void clearComponentInstancePool(facebook::react::SurfaceId surfaceId);
+
  private:
   /**
    * @thread: JS
@@ -77,7 +96,11 @@ class ComponentInstanceProvider
   void processPreallocationRequest(
       PreallocationRequest const& shadowView) override;
 
-  bool shouldPausePreallocationToAvoidBlockingMainThread(
+  /**
+   * Time the preallocation may still use in the current frame. Negative if
+   * the frame's budget is already exceeded.
+   */
+  std::chrono::nanoseconds getPreallocationTimeLeftInFrame(
       UITicker::Timestamp recentVSyncTimestamp);
 };
 } // namespace rnoh
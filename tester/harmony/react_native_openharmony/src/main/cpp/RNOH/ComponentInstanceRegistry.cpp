@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "ComponentInstanceRegistry.h"
+#include <glog/logging.h>
+
+namespace rnoh {
+
+ComponentInstanceRegistry::~ComponentInstanceRegistry() {
+  DLOG(INFO) << "~ComponentInstanceRegistry";
+}
+
+void ComponentInstanceRegistry::deleteByTag(facebook::react::Tag tag) {
+  assertMainThread();
+  auto componentInstance = m_componentInstanceByTag.erase(tag);
+  if (componentInstance == nullptr) {
+    return;
+  }
+  auto componentInstanceId = componentInstance->getId();
+  if (!componentInstanceId.empty()) {
+    std::lock_guard<std::mutex> lock(m_tagByIdMtx);
+    m_tagById.erase(componentInstanceId);
+  }
+}
+
+} // namespace rnoh
@@ -10,11 +10,14 @@
  */
 #pragma once
 #include <memory>
-#include <thread>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include "RNOH/Assert.h"
 #include "RNOH/ComponentInstance.h"
+#include "RNOH/PagedTagMap.h"
 
 namespace rnoh {
 /**
@@ -22,22 +25,19 @@ namespace rnoh {
  *
  * ComponentInstanceRegistry stores the ComponentInstance objects and allows
  * retrieving them by tag or id.
+ *
+ * Instances are kept in a PagedTagMap owned by the MAIN thread: `findByTag`
+ * doesn't take any lock, inserts may come from parallel mounting workers,
+ * and removal happens on the MAIN thread only.
  */
 class ComponentInstanceRegistry : public ComponentInstance::Registry {
  public:
   using Shared = std::shared_ptr<ComponentInstanceRegistry>;
 
-  ~ComponentInstanceRegistry() {
-    DLOG(INFO) << "~ComponentInstanceRegistry";
-  }
+  ~ComponentInstanceRegistry();
 
   ComponentInstance::Shared findByTag(facebook::react::Tag tag) const {
-    std::lock_guard<std::mutex> lock(m_componentInstanceByTagMtx);
-    auto it = m_componentInstanceByTag.find(tag);
-    if (it != m_componentInstanceByTag.end()) {
-      return it->second;
-    }
-    return nullptr;
+    return m_componentInstanceByTag.find(tag);
   }
 
   std::optional<facebook::react::Tag> findTagById(const std::string& id) const {
@@ -59,8 +59,7 @@ class ComponentInstanceRegistry : public ComponentInstance::Registry {
 
   void insert(ComponentInstance::Shared componentInstance) {
     auto tag = componentInstance->getTag();
-    std::lock_guard<std::mutex> lock(m_componentInstanceByTagMtx);
-    m_componentInstanceByTag.emplace(tag, std::move(componentInstance));
+    m_componentInstanceByTag.insert(tag, std::move(componentInstance));
   }
 
   void updateTagById(
@@ -76,39 +75,22 @@ class ComponentInstanceRegistry : public ComponentInstance::Registry {
     }
   }
 
-  void deleteByTag(facebook::react::Tag tag) {
-    std::unordered_map<facebook::react::Tag, ComponentInstance::Shared>::
-        iterator tagAndComponentInstance;
-    {
-      std::lock_guard<std::mutex> lock(m_componentInstanceByTagMtx);
-      tagAndComponentInstance = m_componentInstanceByTag.find(tag);
-      if (tagAndComponentInstance == m_componentInstanceByTag.end()) {
-        return;
-      }
-    }
-    auto componentInstance = tagAndComponentInstance->second;
-    auto componentInstanceId = componentInstance->getId();
-    if (!componentInstanceId.empty()) {
-      std::lock_guard<std::mutex> lock(m_tagByIdMtx);
-      m_tagById.erase(componentInstanceId);
-    }
+  void deleteByTag(facebook::react::Tag tag);
 
-    std::lock_guard<std::mutex> lock(m_componentInstanceByTagMtx);
-    m_componentInstanceByTag.erase(tag);
-  }
+ private:
+  static_assert(std::is_same_v<
+                PagedTagMap<ComponentInstance>::Tag,
+                facebook::react::Tag>);
 
-  private:
-  std::thread::id m_mainThreadId = std::this_thread::get_id();
-  std::unordered_map<facebook::react::Tag, ComponentInstance::Shared>
-      m_componentInstanceByTag = {};
+  PagedTagMap<ComponentInstance> m_componentInstanceByTag;
   std::unordered_map<std::string, facebook::react::Tag> m_tagById = {};
-  mutable std::mutex m_componentInstanceByTagMtx;
   mutable std::mutex m_tagByIdMtx;
 
   void assertMainThread() const {
     RNOH_ASSERT_MSG(
-        m_mainThreadId == std::this_thread::get_id(),
+        m_componentInstanceByTag.getOwnerThreadId() ==
+            std::this_thread::get_id(),
         "ComponentInstanceRegistry must only be accessed on the main thread");
   }
 };
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
@@ -150,15 +150,12 @@ class CppComponentInstance : public ComponentInstance,
   }
 
   void setLayout(facebook::react::LayoutMetrics layoutMetrics) override {
+    auto isFrameChanged = layoutMetrics.frame != m_layoutMetrics.frame;
     this->onLayoutChanged(layoutMetrics);
-//     bool changeFlag =  (layoutMetrics != m_layoutMetrics);
     m_layoutMetrics = layoutMetrics;
-//     if (changeFlag) {
-//       auto parent =  getParent().lock();
-//       if (parent != nullptr) {
-//         parent->onChildLayoutChange(shared_from_this());
-//       }
-//     }
+    if (isFrameChanged) {
+      notifyParentAboutFrameChange();
+    }
   }
 
  public:
@@ -207,7 +204,7 @@ class CppComponentInstance : public ComponentInstance,
   };
 
   bool canSubtreeHandleTouch(facebook::react::Point const& point) override {
-    auto children = getTouchTargetChildren();
+    auto children = getTouchTargetChildrenAt(point);
     for (auto const& child : children) {
       if (child == nullptr) {
         continue;
@@ -247,6 +244,31 @@ class CppComponentInstance : public ComponentInstance,
     return std::vector<TouchTarget::Shared>(children.begin(), children.end());
   }
 
+  std::vector<TouchTarget::Shared> getTouchTargetChildrenAt(
+      facebook::react::Point const& point) override {
+    if (!shouldIndexTouchTargetChildren() ||
+        m_children.size() < MIN_INDEXED_TOUCH_TARGET_CHILDREN_COUNT) {
+      return TouchTarget::getTouchTargetChildrenAt(point);
+    }
+    if (!m_touchTargetChildrenIndex.isBuilt()) {
+      std::vector<facebook::react::Rect> childBoundingBoxes;
+      childBoundingBoxes.reserve(m_children.size());
+      for (auto const& child : m_children) {
+        childBoundingBoxes.push_back(getChildBoundingBox(child));
+      }
+      m_touchTargetChildrenIndex.build(childBoundingBoxes);
+    }
+    std::vector<size_t> childIndices;
+    m_touchTargetChildrenIndex.findChildrenAt(
+        computeContentPoint(point), childIndices);
+    std::vector<TouchTarget::Shared> children;
+    children.reserve(childIndices.size());
+    for (auto childIndex : childIndices) {
+      children.push_back(m_children[childIndex]);
+    }
+    return children;
+  }
+
   facebook::react::Transform getTransform() const override {
     return m_transform;    
   }
@@ -263,6 +285,11 @@ class CppComponentInstance : public ComponentInstance,
   }
 
   void markBoundingBoxAsDirty() override {
+    // the parent indexes children by their bounding boxes even when it clips
+    // them
+    if (auto parent = getParent().lock()) {
+      parent->invalidateTouchTargetChildrenIndex();
+    }
     if (m_boundingBox.has_value()) {
       m_boundingBox.reset();
       auto parent = getTouchTargetParent();
@@ -273,7 +300,48 @@ class CppComponentInstance : public ComponentInstance,
     }
   };
 
+  bool setAnimatedProps(AnimatedProps const& animatedProps) override {
+    // hidden backfaces depend on the whole transform and opacity combined,
+    // which only `setOpacity(props)` handles
+    if (m_props == nullptr ||
+        m_props->backfaceVisibility ==
+            facebook::react::BackfaceVisibility::Hidden) {
+      return false;
+    }
+    if (animatedProps.opacity.has_value()) {
+      auto opacity = animatedProps.opacity.value();
+      this->getLocalRootArkUINode().setOpacity(
+          std::max(0.0f, std::min((float)opacity, 1.0f)));
+      addIgnoredPropKey("opacity");
+    }
+    if (animatedProps.transform.has_value()) {
+      auto const& transform = animatedProps.transform.value();
+      if (transform != m_transform ||
+          abs(m_oldPointScaleFactor - m_layoutMetrics.pointScaleFactor) >
+              0.001f) {
+        m_oldPointScaleFactor = m_layoutMetrics.pointScaleFactor;
+        this->setTransform(transform);
+        this->getLocalRootArkUINode().setTransform(
+            transform, m_layoutMetrics.pointScaleFactor);
+        markBoundingBoxAsDirty();
+      }
+      addIgnoredPropKey("transform");
+    }
+    if (animatedProps.backgroundColor.has_value()) {
+      this->getLocalRootArkUINode().setBackgroundColor(
+          animatedProps.backgroundColor.value());
+      m_isBackgroundColorSetByAnimated = true;
+    }
+    return true;
+  }
+
  protected:
+  void notifyParentAboutFrameChange() {
+    if (auto parent = getParent().lock()) {
+      parent->onChildFrameChanged();
+    }
+  }
+
   virtual void onLayoutChanged(
       facebook::react::LayoutMetrics const& layoutMetrics) {
     this->getLocalRootArkUINode().setLayoutRect(
@@ -286,6 +354,12 @@ class CppComponentInstance : public ComponentInstance,
     markBoundingBoxAsDirty();
   }
 
+  void onRecycle() override {
+    m_eventEmitter = nullptr;
+    m_boundingBox.reset();
+    m_isBackgroundColorSetByAnimated = false;
+  }
+
   virtual void onPropsChanged(SharedConcreteProps const& concreteProps) {
     auto props = std::static_pointer_cast<const facebook::react::ViewProps>(
         concreteProps);
@@ -295,9 +369,14 @@ class CppComponentInstance : public ComponentInstance,
         getIgnoredPropKeys().count("transform") > 0;
     facebook::react::Transform defaultTransform;
         
-    if (old && *(props->backgroundColor) != *(old->backgroundColor)) {
+    // a color set by Animated isn't stored in `m_props`, so the committed one
+    // is applied again
+    if (old &&
+        (*(props->backgroundColor) != *(old->backgroundColor) ||
+         m_isBackgroundColorSetByAnimated)) {
       this->getLocalRootArkUINode().setBackgroundColor(
             props->backgroundColor);
+      m_isBackgroundColorSetByAnimated = false;
     } else if (!old && props->backgroundColor != ARKUI_DEFAULT_BACKGROUND_COLOR) {
       this->getLocalRootArkUINode().setBackgroundColor(
             props->backgroundColor);
@@ -517,20 +596,36 @@ class CppComponentInstance : public ComponentInstance,
     auto newBoundingBox = getHitRect();
     if (!m_isClipping) {
       for (auto& child : m_children) {
-        auto childBoundingBox = child->getBoundingBox();
-        childBoundingBox.origin += child->getLayoutMetrics().frame.origin;
-
-        auto childCenter = child->getLayoutMetrics().frame.getCenter();
-        auto childTransform = child->getTransform();
-
-        childBoundingBox = transformRectAroundPoint(
-            childBoundingBox, childCenter, childTransform);
-        newBoundingBox.unionInPlace(childBoundingBox);
+        newBoundingBox.unionInPlace(getChildBoundingBox(child));
       }
     }
     m_boundingBox = newBoundingBox;
   };
 
+  /**
+   * The bounding box of the child in this component's content coordinates.
+   */
+  facebook::react::Rect getChildBoundingBox(
+      ComponentInstance::Shared const& child) {
+    auto childBoundingBox = child->getBoundingBox();
+    childBoundingBox.origin += child->getLayoutMetrics().frame.origin;
+
+    auto childCenter = child->getLayoutMetrics().frame.getCenter();
+    auto childTransform = child->getTransform();
+
+    return transformRectAroundPoint(
+        childBoundingBox, childCenter, childTransform);
+  }
+
+  /**
+   * Whether `getTouchTargetChildrenAt` may use the spatial index of the
+   * children. Components that customize `getTouchTargetChildren` or
+   * `computeChildPoint` must not enable it.
+   */
+  virtual bool shouldIndexTouchTargetChildren() const {
+    return false;
+  }
+
   void onFinalizeUpdates() override {
     ComponentInstance::onFinalizeUpdates();
     if (m_props != nullptr) {
@@ -583,6 +678,8 @@ class CppComponentInstance : public ComponentInstance,
   };
 
  private:
+  // below that, checking every child is as fast as querying the index
+  static constexpr size_t MIN_INDEXED_TOUCH_TARGET_CHILDREN_COUNT = 16;
 
   facebook::react::Transform m_transform =
     facebook::react::Transform::Identity();  
@@ -685,6 +782,7 @@ class CppComponentInstance : public ComponentInstance,
   SharedConcreteEventEmitter m_eventEmitter;
   std::optional<facebook::react::Rect> m_boundingBox;
   bool m_isClipping = false;
+  bool m_isBackgroundColorSetByAnimated = false;
   
     static ArkUI_Direction convertLayoutDirection(
       facebook::react::LayoutDirection layoutDirection) {
@@ -6,43 +6,109 @@
  */
 
 #include "JSBigStringHelpers.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <stdexcept>
 
-using facebook::react::JSBigFileString;
 using facebook::react::JSBigString;
 
 namespace rnoh::JSBigStringHelpers {
 
-class JSBigStdVecString final : public JSBigString {
+class JSBigPaddedString final : public JSBigString {
 public:
-    explicit JSBigStdVecString(std::vector<uint8_t> buffer, bool isAscii = false)
-        : m_isAscii(isAscii), m_buffer(std::move(buffer))
+    JSBigPaddedString(uint8_t const *data, size_t size)
+        : m_buffer(new char[size + 1]), m_size(size)
     {
+        std::memcpy(m_buffer.get(), data, size);
+        m_buffer[size] = '\0';
     }
 
     bool isAscii() const override
     {
-        return m_isAscii;
+        return false;
     }
 
     const char *c_str() const override
     {
-        return reinterpret_cast<char const *>(m_buffer.data());
+        return m_buffer.get();
     }
 
     size_t size() const override
     {
-        return m_buffer.size();
+        return m_size;
     }
 
 private:
-    bool m_isAscii;
-    std::vector<uint8_t> m_buffer;
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_size;
 };
 
-std::unique_ptr<JSBigString const> fromBuffer(std::vector<uint8_t> buffer)
+/**
+ * Maps a region of a file, followed by a null terminator, into memory.
+ * The region is mapped into a reservation one byte longer than the region,
+ * rounded up to whole pages. When the region ends on a page boundary, the
+ * terminator lands in the zeroed guard page behind it; otherwise it's
+ * written into the private copy of the last page of the region.
+ */
+class JSBigMappedFileString final : public JSBigString {
+public:
+    JSBigMappedFileString(int fd, off_t offset, size_t size) : m_size(size)
+    {
+        size_t pageSize = sysconf(_SC_PAGESIZE);
+        off_t alignedOffset = offset - offset % pageSize;
+        size_t offsetInMapping = offset - alignedOffset;
+        size_t fileMappingSize = offsetInMapping + size;
+        m_mappingSize = (fileMappingSize + 1 + pageSize - 1) / pageSize * pageSize;
+        m_mapping = mmap(nullptr, m_mappingSize, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (m_mapping == MAP_FAILED) {
+            throw std::runtime_error("Failed to reserve memory for the JS bundle");
+        }
+        if (fileMappingSize > 0 &&
+            mmap(m_mapping, fileMappingSize, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_FIXED, fd, alignedOffset) == MAP_FAILED) {
+            munmap(m_mapping, m_mappingSize);
+            throw std::runtime_error("Failed to map the JS bundle");
+        }
+        m_data = static_cast<char *>(m_mapping) + offsetInMapping;
+        m_data[size] = '\0';
+        mprotect(m_mapping, m_mappingSize, PROT_READ);
+    }
+
+    ~JSBigMappedFileString() override
+    {
+        munmap(m_mapping, m_mappingSize);
+    }
+
+    bool isAscii() const override
+    {
+        return false;
+    }
+
+    const char *c_str() const override
+    {
+        return m_data;
+    }
+
+    size_t size() const override
+    {
+        return m_size;
+    }
+
+private:
+    void *m_mapping;
+    size_t m_mappingSize;
+    char *m_data;
+    size_t m_size;
+};
+
+std::unique_ptr<JSBigString const> fromBuffer(uint8_t const *data, size_t size)
 {
     try {
-        return std::make_unique<JSBigStdVecString>(std::move(buffer));
+        return std::make_unique<JSBigPaddedString>(data, size);
     } catch (...) {
         return nullptr;
     }
@@ -66,9 +132,16 @@ std::unique_ptr<JSBigString const> fromRawFilePath(
         throw std::runtime_error("Failed to get raw file descriptor data: " + rawFilePath);
     }
 
-    auto result = std::make_unique<JSBigFileString>(bundleRawFileDescriptor.fd,
-        bundleRawFileDescriptor.length,
-        bundleRawFileDescriptor.start);
+    // the mapping stays valid after the descriptor is released
+    std::unique_ptr<JSBigString const> result;
+    try {
+        result = std::make_unique<JSBigMappedFileString>(bundleRawFileDescriptor.fd,
+            bundleRawFileDescriptor.start,
+            bundleRawFileDescriptor.length);
+    } catch (...) {
+        OH_ResourceManager_ReleaseRawFileDescriptorData(&bundleRawFileDescriptor);
+        throw;
+    }
 
     OH_ResourceManager_ReleaseRawFileDescriptorData(&bundleRawFileDescriptor);
 
@@ -77,6 +150,22 @@ std::unique_ptr<JSBigString const> fromRawFilePath(
 
 std::unique_ptr<JSBigString const> fromFilePath(std::string const &filePath)
 {
-    return JSBigFileString::fromPath(filePath);
+    auto fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open file: " + filePath);
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        throw std::runtime_error("Failed to get the size of file: " + filePath);
+    }
+    try {
+        auto result = std::make_unique<JSBigMappedFileString>(fd, 0, fileStat.st_size);
+        close(fd);
+        return result;
+    } catch (...) {
+        close(fd);
+        throw;
+    }
 }
-} // namespace rnoh::JSBigStringHelpers
\ No newline at end of file
+} // namespace rnoh::JSBigStringHelpers
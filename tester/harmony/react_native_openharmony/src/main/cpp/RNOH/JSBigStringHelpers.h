@@ -9,11 +9,19 @@
 
 #include <cxxreact/JSBigString.h>
 #include <rawfile/raw_file_manager.h>
+#include <memory>
+#include <string>
 
+/**
+ * All returned strings are null-terminated, as required by engines loading
+ * JS source, without copying bundles more than once: buffers are copied
+ * once into a null-padded allocation and files are mapped into memory.
+ */
 namespace rnoh::JSBigStringHelpers {
 
 std::unique_ptr<facebook::react::JSBigString const> fromBuffer(
-    std::vector<uint8_t> buffer);
+    uint8_t const *data,
+    size_t size);
 
 std::unique_ptr<facebook::react::JSBigString const> fromRawFilePath(
     std::string const &rawfilePath,
@@ -22,4 +30,4 @@ std::unique_ptr<facebook::react::JSBigString const> fromRawFilePath(
 std::unique_ptr<facebook::react::JSBigString const> fromFilePath(
     std::string const &filePath);
 
-} // namespace rnoh::JSBigStringHelpers
\ No newline at end of file
+} // namespace rnoh::JSBigStringHelpers
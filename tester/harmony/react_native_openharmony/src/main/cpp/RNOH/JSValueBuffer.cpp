@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "JSValueBuffer.h"
+#include <stdexcept>
+
+namespace rnoh {
+
+using namespace facebook;
+
+using Type = TypedValueBuffer::Type;
+using Bytes = TypedValueBuffer::Bytes;
+
+namespace {
+/**
+ * Exposes bytes stored in a JSValueBuffer to the JS runtime without copying
+ * them.
+ */
+class BytesMutableBuffer : public jsi::MutableBuffer {
+ public:
+  explicit BytesMutableBuffer(std::shared_ptr<Bytes> bytes)
+      : m_bytes(std::move(bytes)) {}
+
+  size_t size() const override {
+    return m_bytes->size();
+  }
+
+  uint8_t* data() override {
+    return m_bytes->data();
+  }
+
+ private:
+  std::shared_ptr<Bytes> m_bytes;
+};
+
+void maybeThrowFromStatus(napi_status status, const char* message) {
+  if (status != napi_ok) {
+    throw std::runtime_error(message);
+  }
+}
+} // namespace
+
+JSValueBuffer JSValueBuffer::fromJSIValues(
+    jsi::Runtime& runtime,
+    jsi::Value const* values,
+    size_t valuesCount,
+    CallbackFactory const& createCallback) {
+  JSValueBuffer buffer;
+  for (size_t i = 0; i < valuesCount; i++) {
+    auto const& value = values[i];
+    if (value.isObject()) {
+      auto object = value.getObject(runtime);
+      if (object.isFunction(runtime)) {
+        buffer.m_values.writeCallback(buffer.m_callbacks.size());
+        buffer.m_callbacks.push_back(
+            createCallback(runtime, object.getFunction(runtime)));
+        continue;
+      }
+      buffer.writeJSIObject(runtime, object);
+      continue;
+    }
+    buffer.writeJSIValue(runtime, value);
+  }
+  buffer.m_valuesCount = valuesCount;
+  return buffer;
+}
+
+JSValueBuffer JSValueBuffer::fromNapiValue(ArkJS& arkJS, napi_value value) {
+  JSValueBuffer buffer;
+  buffer.writeNapiValue(arkJS, value);
+  buffer.m_valuesCount = 1;
+  return buffer;
+}
+
+std::vector<napi_value> JSValueBuffer::toNapiValues(ArkJS& arkJS) {
+  std::vector<napi_value> values;
+  values.reserve(m_valuesCount);
+  Reader reader(m_values);
+  for (size_t i = 0; i < m_valuesCount; i++) {
+    values.push_back(readNapiValue(arkJS, reader));
+  }
+  return values;
+}
+
+jsi::Value JSValueBuffer::toJSIValue(jsi::Runtime& runtime) {
+  if (m_valuesCount == 0) {
+    return jsi::Value::undefined();
+  }
+  Reader reader(m_values);
+  return readJSIValue(runtime, reader);
+}
+
+void JSValueBuffer::writeJSIValue(
+    jsi::Runtime& runtime,
+    jsi::Value const& value) {
+  if (value.isUndefined() || value.isNull()) {
+    m_values.writeNull();
+  } else if (value.isBool()) {
+    m_values.writeBoolean(value.getBool());
+  } else if (value.isNumber()) {
+    m_values.writeNumber(value.getNumber());
+  } else if (value.isString()) {
+    auto string = value.getString(runtime).utf8(runtime);
+    m_values.writeString(string.data(), string.size());
+  } else if (value.isObject()) {
+    auto object = value.getObject(runtime);
+    if (object.isFunction(runtime)) {
+      throw jsi::JSError(
+          runtime, "JS Functions are not convertible to dynamic");
+    }
+    writeJSIObject(runtime, object);
+  } else if (value.isBigInt()) {
+    throw jsi::JSError(runtime, "JS BigInts are not convertible to dynamic");
+  } else if (value.isSymbol()) {
+    throw jsi::JSError(runtime, "JS Symbols are not convertible to dynamic");
+  } else {
+    throw jsi::JSError(runtime, "Value is not convertible to dynamic");
+  }
+}
+
+void JSValueBuffer::writeJSIObject(
+    jsi::Runtime& runtime,
+    jsi::Object const& object) {
+  if (object.isArray(runtime)) {
+    auto array = object.getArray(runtime);
+    auto length = array.size(runtime);
+    m_values.writeArray(length);
+    for (size_t i = 0; i < length; i++) {
+      writeJSIValue(runtime, array.getValueAtIndex(runtime, i));
+    }
+    return;
+  }
+  if (object.isArrayBuffer(runtime)) {
+    auto arrayBuffer = object.getArrayBuffer(runtime);
+    m_values.writeArrayBuffer(
+        arrayBuffer.data(runtime), arrayBuffer.size(runtime));
+    return;
+  }
+  auto names = object.getPropertyNames(runtime);
+  auto namesCount = names.size(runtime);
+  auto objectOffset = m_values.beginObject();
+  size_t propertiesCount = 0;
+  for (size_t i = 0; i < namesCount; i++) {
+    auto name = names.getValueAtIndex(runtime, i).getString(runtime);
+    auto property = object.getProperty(runtime, name);
+    if (property.isUndefined()) {
+      continue;
+    }
+    auto key = name.utf8(runtime);
+    m_values.writeKey(key.data(), key.size());
+    // the same substitution as JSON.stringify
+    if (property.isObject() &&
+        property.getObject(runtime).isFunction(runtime)) {
+      m_values.writeNull();
+    } else {
+      writeJSIValue(runtime, property);
+    }
+    propertiesCount++;
+  }
+  m_values.endObject(objectOffset, propertiesCount);
+}
+
+void JSValueBuffer::writeNapiValue(ArkJS& arkJS, napi_value value) {
+  auto env = arkJS.getEnv();
+  switch (arkJS.getType(value)) {
+    case napi_boolean:
+      m_values.writeBoolean(arkJS.getBoolean(value));
+      return;
+    case napi_number:
+      m_values.writeNumber(arkJS.getDouble(value));
+      return;
+    case napi_string: {
+      size_t length;
+      maybeThrowFromStatus(
+          napi_get_value_string_utf8(env, value, nullptr, 0, &length),
+          "Failed to get the length of the string");
+      // the string is written directly into the buffer, NUL included
+      auto data = m_values.writeStringInPlace(length);
+      maybeThrowFromStatus(
+          napi_get_value_string_utf8(env, value, data, length + 1, &length),
+          "Failed to get the string data");
+      return;
+    }
+    case napi_object: {
+      bool isArray = false;
+      maybeThrowFromStatus(
+          napi_is_array(env, value, &isArray), "Failed to check for an array");
+      if (isArray) {
+        auto length = arkJS.getArrayLength(value);
+        m_values.writeArray(length);
+        for (uint32_t i = 0; i < length; i++) {
+          writeNapiValue(arkJS, arkJS.getArrayElement(value, i));
+        }
+        return;
+      }
+      if (arkJS.isArrayBuffer(value)) {
+        void* data;
+        size_t size;
+        maybeThrowFromStatus(
+            napi_get_arraybuffer_info(env, value, &data, &size),
+            "Failed to read array buffer");
+        m_values.writeArrayBuffer(static_cast<uint8_t const*>(data), size);
+        return;
+      }
+      auto properties = arkJS.getObjectProperties(value);
+      auto objectOffset = m_values.beginObject();
+      for (auto const& [key, property] : properties) {
+        auto keyString = arkJS.getString(key);
+        m_values.writeKey(keyString.data(), keyString.size());
+        writeNapiValue(arkJS, property);
+      }
+      m_values.endObject(objectOffset, properties.size());
+      return;
+    }
+    default:
+      m_values.writeNull();
+      return;
+  }
+}
+
+napi_value JSValueBuffer::readNapiValue(ArkJS& arkJS, Reader& reader) {
+  auto env = arkJS.getEnv();
+  switch (reader.readType()) {
+    case Type::Null:
+      return arkJS.getNull();
+    case Type::False:
+      return arkJS.createBoolean(false);
+    case Type::True:
+      return arkJS.createBoolean(true);
+    case Type::Number:
+      return arkJS.createDouble(reader.readNumber());
+    case Type::String: {
+      size_t length;
+      auto data = reader.readString(length);
+      napi_value result;
+      maybeThrowFromStatus(
+          napi_create_string_utf8(env, data, length, &result),
+          "Failed to create a string");
+      return result;
+    }
+    case Type::Array: {
+      auto length = reader.readSize();
+      napi_value result;
+      maybeThrowFromStatus(
+          napi_create_array_with_length(env, length, &result),
+          "Failed to create an array");
+      for (size_t i = 0; i < length; i++) {
+        napi_set_element(env, result, i, readNapiValue(arkJS, reader));
+      }
+      return result;
+    }
+    case Type::Object: {
+      auto propertiesCount = reader.readSize();
+      napi_value result;
+      maybeThrowFromStatus(
+          napi_create_object(env, &result), "Failed to create an object");
+      for (size_t i = 0; i < propertiesCount; i++) {
+        size_t keyLength;
+        auto key = reader.readString(keyLength);
+        napi_set_named_property(env, result, key, readNapiValue(arkJS, reader));
+      }
+      return result;
+    }
+    case Type::ArrayBuffer: {
+      // the ArrayBuffer keeps the stored bytes alive instead of copying them
+      auto bytes = new std::shared_ptr<Bytes>(reader.readArrayBuffer());
+      napi_value result;
+      auto status = napi_create_external_arraybuffer(
+          env,
+          (*bytes)->data(),
+          (*bytes)->size(),
+          [](napi_env /*env*/, void* /*data*/, void* hint) {
+            delete static_cast<std::shared_ptr<Bytes>*>(hint);
+          },
+          bytes,
+          &result);
+      if (status != napi_ok) {
+        delete bytes;
+        throw std::runtime_error("Failed to create an array buffer");
+      }
+      return result;
+    }
+    case Type::Callback:
+      return arkJS.createSingleUseCallback(
+          std::move(m_callbacks[reader.readSize()]));
+  }
+  throw std::runtime_error("Invalid JSValueBuffer");
+}
+
+jsi::Value JSValueBuffer::readJSIValue(
+    jsi::Runtime& runtime,
+    Reader& reader) {
+  switch (reader.readType()) {
+    case Type::Null:
+      return jsi::Value::null();
+    case Type::False:
+      return jsi::Value(false);
+    case Type::True:
+      return jsi::Value(true);
+    case Type::Number:
+      return jsi::Value(reader.readNumber());
+    case Type::String: {
+      size_t length;
+      auto data = reader.readString(length);
+      return jsi::String::createFromUtf8(
+          runtime, reinterpret_cast<uint8_t const*>(data), length);
+    }
+    case Type::Array: {
+      auto length = reader.readSize();
+      jsi::Array result(runtime, length);
+      for (size_t i = 0; i < length; i++) {
+        result.setValueAtIndex(runtime, i, readJSIValue(runtime, reader));
+      }
+      return result;
+    }
+    case Type::Object: {
+      auto propertiesCount = reader.readSize();
+      jsi::Object result(runtime);
+      for (size_t i = 0; i < propertiesCount; i++) {
+        size_t keyLength;
+        auto key = reader.readString(keyLength);
+        auto name = jsi::PropNameID::forUtf8(
+            runtime, reinterpret_cast<uint8_t const*>(key), keyLength);
+        result.setProperty(runtime, name, readJSIValue(runtime, reader));
+      }
+      return result;
+    }
+    case Type::ArrayBuffer:
+      return jsi::ArrayBuffer(
+          runtime,
+          std::make_shared<BytesMutableBuffer>(reader.readArrayBuffer()));
+    case Type::Callback:
+      break;
+  }
+  throw std::runtime_error("Invalid JSValueBuffer");
+}
+
+} // namespace rnoh
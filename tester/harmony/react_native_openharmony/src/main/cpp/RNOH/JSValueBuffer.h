@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "RNOH/ArkJS.h"
+#include "RNOH/TypedValueBuffer.h"
+
+namespace rnoh {
+
+/**
+ * @internal
+ * JS values serialized into a flat, typed byte buffer, which is written on
+ * one thread and read on another. It lets ArkTSTurboModule pass values
+ * between the JS runtime and ArkTS without building an intermediate
+ * `folly::dynamic` tree. The contents of ArrayBuffers are stored once and
+ * the NAPI ArrayBuffers are created on top of the stored bytes.
+ *
+ * Conversions follow `jsi::dynamicFromValue` and `ArkJS::getDynamic`:
+ * `undefined` becomes `null`, object properties that are `undefined` are
+ * skipped and functions nested in objects become `null`.
+ */
+class JSValueBuffer {
+ public:
+  using CallbackFactory = std::function<ArkJS::IntermediaryCallback(
+      facebook::jsi::Runtime&,
+      facebook::jsi::Function&&)>;
+
+  /**
+   * Serializes TurboModule method arguments. Functions passed as arguments
+   * are turned into callbacks by `createCallback`.
+   *
+   * @thread: JS
+   */
+  static JSValueBuffer fromJSIValues(
+      facebook::jsi::Runtime& runtime,
+      facebook::jsi::Value const* values,
+      size_t valuesCount,
+      CallbackFactory const& createCallback);
+
+  /**
+   * @thread: the thread of the NAPI environment
+   */
+  static JSValueBuffer fromNapiValue(ArkJS& arkJS, napi_value value);
+
+  /**
+   * Callbacks are moved out, so the buffer can be read only once.
+   *
+   * @thread: the thread of the NAPI environment
+   */
+  std::vector<napi_value> toNapiValues(ArkJS& arkJS);
+
+  /**
+   * Returns the first value stored in the buffer.
+   *
+   * @thread: JS
+   */
+  facebook::jsi::Value toJSIValue(facebook::jsi::Runtime& runtime);
+
+ private:
+  using Reader = TypedValueBuffer::Reader;
+
+  void writeJSIValue(
+      facebook::jsi::Runtime& runtime,
+      facebook::jsi::Value const& value);
+  void writeJSIObject(
+      facebook::jsi::Runtime& runtime,
+      facebook::jsi::Object const& object);
+  void writeNapiValue(ArkJS& arkJS, napi_value value);
+
+  napi_value readNapiValue(ArkJS& arkJS, Reader& reader);
+  facebook::jsi::Value readJSIValue(
+      facebook::jsi::Runtime& runtime,
+      Reader& reader);
+
+  TypedValueBuffer m_values;
+  std::vector<ArkJS::IntermediaryCallback> m_callbacks;
+  size_t m_valuesCount = 0;
+};
+
+} // namespace rnoh
@@ -8,16 +8,95 @@
 #include "RNOH/LogSink.h"
 #include <hilog/log.h>
 #include <pthread.h>
+#include <cstring>
+#ifdef ASYNC_LOGGING_ON
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include "RNOH/AsyncLogWriter.h"
+#endif
 
 #define LOG_DOMAIN 0xBEEF
 #define LOG_TAG "#RNOH_CPP"
 
 LogSink* LogSink::instance = nullptr;
 
-std::string getThreadSymbol() {
-  char c_threadName[16] = {0};
-  pthread_getname_np(pthread_self(), c_threadName, sizeof(c_threadName));
-  auto threadName = std::string(c_threadName);
+#ifdef ASYNC_LOGGING_ON
+namespace {
+/**
+ * Limits the number of lines logged by a single `LOG` statement per second,
+ * so that a statement in a hot loop can't flood the log buffers. Call sites
+ * are hashed into a fixed table and colliding sites share the limit.
+ */
+class CallSiteRateLimiter {
+ public:
+  static constexpr uint32_t MAX_LINES_PER_SECOND = 64;
+
+  /**
+   * Returns false if the line shouldn't be logged. When a new window starts
+   * for the call site, `suppressedLinesCount` is set to the number of lines
+   * suppressed during the previous one.
+   */
+  bool tryAcquire(
+      const char* filename,
+      int line,
+      uint32_t& suppressedLinesCount) {
+    auto hash = std::hash<const void*>{}(filename) ^
+        (static_cast<size_t>(line) * 0x9E3779B97F4A7C15ull);
+    auto& entry = m_entries[hash % ENTRIES_COUNT];
+    auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::steady_clock::now().time_since_epoch())
+                     .count();
+    auto windowStartMs = entry.windowStartMs.load(std::memory_order_relaxed);
+    if (nowMs - windowStartMs >= 1000 &&
+        entry.windowStartMs.compare_exchange_strong(
+            windowStartMs, nowMs, std::memory_order_relaxed)) {
+      entry.linesCount.store(0, std::memory_order_relaxed);
+      suppressedLinesCount =
+          entry.suppressedLinesCount.exchange(0, std::memory_order_relaxed);
+    }
+    if (entry.linesCount.fetch_add(1, std::memory_order_relaxed) >=
+        MAX_LINES_PER_SECOND) {
+      entry.suppressedLinesCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  static constexpr size_t ENTRIES_COUNT = 256;
+
+  struct Entry {
+    std::atomic<int64_t> windowStartMs{0};
+    std::atomic<uint32_t> linesCount{0};
+    std::atomic<uint32_t> suppressedLinesCount{0};
+  };
+
+  std::array<Entry, ENTRIES_COUNT> m_entries{};
+};
+
+CallSiteRateLimiter callSiteRateLimiter;
+
+LogLevel toLogLevel(google::LogSeverity severity) {
+  switch (severity) {
+    case google::GLOG_INFO:
+      return LOG_INFO;
+    case google::GLOG_ERROR:
+      return LOG_ERROR;
+    case google::GLOG_FATAL:
+      return LOG_FATAL;
+    case google::GLOG_WARNING:
+    default:
+      return LOG_WARN;
+  }
+}
+} // namespace
+#endif
+
+const char* getThreadSymbol(std::string const& threadName) {
   if (threadName == "RNOH_JS") {
     return "__█__";
   } else if (threadName == "RNOH_BACKGROUND") {
@@ -31,6 +110,25 @@ std::string getThreadSymbol() {
   }
 }
 
+/**
+ * Returns the symbol of the calling thread. It's cached per thread and
+ * recomputed only when the thread was renamed since the last line, e.g.
+ * by a thread pool that names its workers after they start.
+ */
+const char* getCurrentThreadSymbol() {
+  constexpr size_t THREAD_NAME_SIZE = 16;
+  thread_local char cachedThreadName[THREAD_NAME_SIZE] = {0};
+  thread_local const char* threadSymbol = nullptr;
+  char threadName[THREAD_NAME_SIZE] = {0};
+  pthread_getname_np(pthread_self(), threadName, sizeof(threadName));
+  if (threadSymbol == nullptr ||
+      std::strncmp(threadName, cachedThreadName, THREAD_NAME_SIZE) != 0) {
+    std::memcpy(cachedThreadName, threadName, THREAD_NAME_SIZE);
+    threadSymbol = getThreadSymbol(threadName);
+  }
+  return threadSymbol;
+}
+
 void LogSink::initializeLogging() {
   if (!instance) {
     instance = new LogSink();
@@ -48,9 +146,48 @@ void LogSink::send(
     const ::tm* /*tm_time*/,
     const char* message,
     size_t message_len) {
+  auto threadSymbol = getCurrentThreadSymbol();
+
+#ifdef ASYNC_LOGGING_ON
+  if (severity < google::GLOG_FATAL) {
+    uint32_t suppressedLinesCount = 0;
+    if (severity < google::GLOG_ERROR &&
+        !callSiteRateLimiter.tryAcquire(
+            base_filename, line, suppressedLinesCount)) {
+      return;
+    }
+    char lineNumber[16];
+    auto lineNumberEnd =
+        std::to_chars(lineNumber, lineNumber + sizeof(lineNumber), line).ptr;
+    char suppressedNote[48] = {0};
+    if (suppressedLinesCount > 0) {
+      snprintf(
+          suppressedNote,
+          sizeof(suppressedNote),
+          "(%u similar lines suppressed) ",
+          suppressedLinesCount);
+    }
+    if (rnoh::AsyncLogWriter::getInstance().write(
+            toLogLevel(severity),
+            LOG_TAG,
+            {threadSymbol,
+             " ",
+             base_filename,
+             ":",
+             std::string_view(lineNumber, lineNumberEnd - lineNumber),
+             "> ",
+             suppressedNote,
+             std::string_view(message, message_len)})) {
+      return;
+    }
+  }
+  // the process is about to abort, or the line doesn't fit into the buffer
+  rnoh::AsyncLogWriter::getInstance().flush();
+#endif
+
   std::ostringstream stream;
 
-  stream << getThreadSymbol() << " " << base_filename << ':' << line << "> "
+  stream << threadSymbol << " " << base_filename << ':' << line << "> "
          << std::string(message, message_len);
   auto messageString = stream.str();
   auto c_str = messageString.c_str();
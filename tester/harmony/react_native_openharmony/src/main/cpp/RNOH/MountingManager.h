@@ -77,6 +77,14 @@ class MountingManager {
       folly::dynamic props,
       facebook::react::ComponentDescriptor const& componentDescriptor) = 0;
 
+  /**
+   * Returns false if the props weren't applied and need to go through
+   * `updateView`.
+   */
+  virtual bool updateAnimatedProps(
+      facebook::react::Tag tag,
+      AnimatedProps const& animatedProps) = 0;
+
   virtual void clearPreallocatedViews() = 0;
   
   virtual void clearPreallocatedViews(
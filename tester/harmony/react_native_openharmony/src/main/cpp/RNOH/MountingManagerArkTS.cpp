@@ -84,6 +84,12 @@ void MountingManagerArkTS::updateView(
   throw RNOHError("updateView is not implemented in ArkTS architecture.");
 }
 
+bool MountingManagerArkTS::updateAnimatedProps(
+    facebook::react::Tag tag,
+    AnimatedProps const& animatedProps) {
+  return false;
+}
+
 void MountingManagerArkTS::clearPreallocatedViews() {
   throw RNOHError("Preallocation is not implemented in ArkTS architecture.");
 }
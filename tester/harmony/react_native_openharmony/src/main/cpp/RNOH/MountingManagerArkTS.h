@@ -75,6 +75,10 @@ class MountingManagerArkTS final : public MountingManager {
       folly::dynamic props,
       facebook::react::ComponentDescriptor const& componentDescriptor) override;
 
+  bool updateAnimatedProps(
+      facebook::react::Tag tag,
+      AnimatedProps const& animatedProps) override;
+
     void clearPreallocatedViews();
     void clearPreallocatedViews(facebook::react::ShadowViewMutationList mutations);
     void clearPreallocationRequestQueue();
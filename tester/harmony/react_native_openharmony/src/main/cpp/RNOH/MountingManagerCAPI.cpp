@@ -10,7 +10,10 @@
 #include "RNOH/Performance/HarmonyReactMarker.h"
 #include "RNOH/ParallelComponent.h"
 #include "RNOH/ApiVersionCheck.h"
+#include "RNOH/MutationCostModel.h"
 #include "RNOH/ParallelCheck.h"
+#include <algorithm>
+#include <chrono>
 #include <string_view>
 
 namespace rnoh {
@@ -76,14 +79,22 @@ void MountingManagerCAPI::didMount(MutationList const &mutations) {
 
   facebook::react::SystraceSection s(
       "#RNOH::MountingManager::didMount size = ", mutations.size());
+  // one clock read per mutation: a mutation ends where the next one starts
+  MutationCostModel::SampleBatch costSamples(mutations.size());
+  auto startTime = std::chrono::steady_clock::now();
   for (uint64_t i = 0; i < mutations.size(); ++i) {
     auto const &mutation = mutations[i];
       try {
         this->handleMutation(mutation);
+        auto endTime = std::chrono::steady_clock::now();
+        costSamples.add(mutation, endTime - startTime);
+        startTime = endTime;
       } catch (std::exception const &e) {
         LOG(ERROR) << "Mutation " << getMutationNameFromType(mutation.type) << " failed: " << e.what();
+        startTime = std::chrono::steady_clock::now();
       }
   }
+  MutationCostModel::getInstance().recordSamples(costSamples);
   HarmonyReactMarker::logMarker(
       HarmonyReactMarker::HarmonyReactMarkerId::FABRIC_BATCH_EXECUTION_END);
 }
@@ -216,12 +227,24 @@ void MountingManagerCAPI::updateView(
   componentInstance->setIgnoredPropKeys(std::move(propKeys));
 }
 
+bool MountingManagerCAPI::updateAnimatedProps(
+    facebook::react::Tag tag,
+    AnimatedProps const& animatedProps) {
+  auto componentInstance = m_componentInstanceRegistry->findByTag(tag);
+  if (componentInstance == nullptr) {
+    // nothing to update, same as in `updateView`
+    return true;
+  }
+  return componentInstance->setAnimatedProps(animatedProps);
+}
+
 void MountingManagerCAPI::updateComponentWithShadowView(
     ComponentInstance::Shared const& componentInstance,
-    facebook::react::ShadowView const& shadowView) {
+    facebook::react::ShadowView const& shadowView,
+    std::string const& prevId) {
   // NOTE: updating tag by id must happen before updating props
      m_componentInstanceRegistry->updateTagById(
-        shadowView.tag, shadowView.props->nativeId, componentInstance->getId());
+        shadowView.tag, shadowView.props->nativeId, prevId);
     componentInstance->setShadowView(shadowView);
     componentInstance->setLayout(shadowView.layoutMetrics);
     componentInstance->setEventEmitter(shadowView.eventEmitter);
@@ -259,6 +282,28 @@ bool MountingManagerCAPI::isComponentSupportedForParallelization(
   return componentInstance->getComponentName() == FAST_IMAGE_VIEW;
 }
 
+bool MountingManagerCAPI::canRecycleComponentInstance(
+    ComponentInstance::Shared const& componentInstance) const {
+  if (!componentInstance->isRecyclable() ||
+      !componentInstance->getChildren().empty() ||
+      !componentInstance->getIgnoredPropKeys().empty()) {
+    return false;
+  }
+  // REMOVE precedes DELETE, so the old parent must not own the instance
+  // anymore
+  auto parent = componentInstance->getParent().lock();
+  if (parent != nullptr) {
+    auto const& siblings = parent->getChildren();
+    if (std::find(siblings.begin(), siblings.end(), componentInstance) !=
+        siblings.end()) {
+      return false;
+    }
+  }
+  // any other owner (e.g. the preallocation cache or a native module) could
+  // still use the instance after it's reused for a different tag
+  return componentInstance.use_count() == 1;
+}
+
 void MountingManagerCAPI::handleMutation(Mutation const &mutation) {
     DVLOG(1) << "Mutation (type:" << getMutationNameFromType(mutation.type)
              << "; componentName: "
@@ -274,7 +319,10 @@ void MountingManagerCAPI::handleMutation(Mutation const &mutation) {
         auto newChild = mutation.newChildShadowView;
         auto componentInstance =
               m_componentInstanceProvider->getComponentInstance(
-                  newChild.tag, newChild.componentHandle, newChild.componentName);
+                  newChild.surfaceId,
+                  newChild.tag,
+                  newChild.componentHandle,
+                  newChild.componentName);
 
       if (componentInstance == nullptr) {
         componentInstance = m_componentInstanceProvider->createArkTSComponent(
@@ -287,12 +335,21 @@ void MountingManagerCAPI::handleMutation(Mutation const &mutation) {
           return;
         }
         m_componentInstanceRegistry->insert(componentInstance);
-        updateComponentWithShadowView(componentInstance, newChild);
+        // a recycled instance still carries the nativeId of the deleted
+        // component, which was already unregistered in DELETE
+        updateComponentWithShadowView(componentInstance, newChild, "");
         break;
       }
       case facebook::react::ShadowViewMutation::Delete: {
         auto oldChild = mutation.oldChildShadowView;
+        auto componentInstance =
+            m_componentInstanceRegistry->findByTag(oldChild.tag);
         m_componentInstanceRegistry->deleteByTag(oldChild.tag);
+        if (componentInstance != nullptr &&
+            canRecycleComponentInstance(componentInstance)) {
+          m_componentInstanceProvider->recycleComponentInstance(
+              oldChild.surfaceId, std::move(componentInstance));
+        }
         break;
       }
       case facebook::react::ShadowViewMutation::Insert: {
@@ -331,7 +388,9 @@ void MountingManagerCAPI::handleMutation(Mutation const &mutation) {
             mutation.newChildShadowView.tag);
         if (componentInstance != nullptr) {
           updateComponentWithShadowView(
-              componentInstance, mutation.newChildShadowView);
+              componentInstance,
+              mutation.newChildShadowView,
+              componentInstance->getId());
         }
         break;
       }
@@ -402,4 +461,21 @@ void MountingManagerCAPI::clearPreallocatedViews(facebook::react::ShadowViewMuta
 void MountingManagerCAPI::clearPreallocationRequestQueue() {
   m_componentInstanceProvider->clearPreallocationRequestQueue();
 }
+
+void MountingManagerCAPI::createComponentInstancePool(
+    facebook::react::SurfaceId surfaceId) {
+  m_componentInstanceProvider->createComponentInstancePool(surfaceId);
+}
+
+bool MountingManagerCAPI::setComponentInstancePoolCapacity(
+    facebook::react::SurfaceId surfaceId,
+    size_t capacity) {
+  return m_componentInstanceProvider->setComponentInstancePoolCapacity(
+      surfaceId, capacity);
+}
+
+void MountingManagerCAPI::clearComponentInstancePool(
+    facebook::react::SurfaceId surfaceId) {
+  m_componentInstanceProvider->clearComponentInstancePool(surfaceId);
+}
 } // namespace rnoh
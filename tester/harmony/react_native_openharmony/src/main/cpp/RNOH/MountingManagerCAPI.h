@@ -86,6 +86,10 @@ class MountingManagerCAPI final : public MountingManager {
       facebook::react::Tag tag,
       folly::dynamic props,
       facebook::react::ComponentDescriptor const& componentDescriptor) override;
+
+  bool updateAnimatedProps(
+      facebook::react::Tag tag,
+      AnimatedProps const& animatedProps) override;
     
   void schedulerDidSendAccessibilityEvent(
       const facebook::react::ShadowView& shadowView,
@@ -95,6 +99,12 @@ class MountingManagerCAPI final : public MountingManager {
     void clearPreallocatedViews(facebook::react::ShadowViewMutationList mutations);
     void clearPreallocationRequestQueue();
 
+  void createComponentInstancePool(facebook::react::SurfaceId surfaceId);
+  bool setComponentInstancePoolCapacity(
+      facebook::react::SurfaceId surfaceId,
+      size_t capacity);
+  void clearComponentInstancePool(facebook::react::SurfaceId surfaceId);
+
  private:
   static const std::unordered_set<facebook::react::ComponentHandle>& getSupportedHandles();
 
@@ -103,7 +113,11 @@ class MountingManagerCAPI final : public MountingManager {
     
   void updateComponentWithShadowView(
       ComponentInstance::Shared const& componentInstance,
-      facebook::react::ShadowView const& shadowView);
+      facebook::react::ShadowView const& shadowView,
+      std::string const& prevId);
+
+  bool canRecycleComponentInstance(
+      ComponentInstance::Shared const& componentInstance) const;
 
   void finalizeMutationUpdates(MutationList const& mutations);
 
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "MutationCostModel.h"
+#include <algorithm>
+
+namespace rnoh {
+
+namespace {
+// Until this many samples were collected for a component type the running
+// mean is used; afterwards samples are folded in with an EWMA.
+constexpr uint32_t MIN_SAMPLES_FOR_ESTIMATE = 4;
+// EWMA weight of a new sample is 1 / EWMA_WEIGHT_DIVISOR.
+constexpr int64_t EWMA_WEIGHT_DIVISOR = 8;
+// A single sample is clamped so that a one-off stall (GC, page fault) can't
+// make a component type look expensive for a long time.
+constexpr int64_t MAX_SAMPLE_US = 16000;
+
+// Defaults measured on a mid-range device; the relative weights match the
+// heuristic previously hard-coded in SchedulerDelegate.
+constexpr int64_t DEFAULT_COST_CREATE_US = 60;
+constexpr int64_t DEFAULT_COST_UPDATE_US = 10;
+constexpr int64_t DEFAULT_COST_INSERT_US = 15;
+constexpr int64_t DEFAULT_COST_REMOVE_US = 15;
+constexpr int64_t DEFAULT_COST_DELETE_US = 20;
+} // namespace
+
+MutationCostModel& MutationCostModel::getInstance() {
+  static MutationCostModel instance;
+  return instance;
+}
+
+MutationCostModel::SampleBatch::SampleBatch(size_t expectedSamplesCount) {
+  m_samples.reserve(expectedSamplesCount);
+}
+
+void MutationCostModel::SampleBatch::add(
+    Mutation const& mutation,
+    std::chrono::nanoseconds duration) {
+  m_samples.push_back(Sample{
+      getComponentHandle(mutation),
+      getTypeIndex(mutation.type),
+      std::clamp<int64_t>(
+          std::chrono::duration_cast<std::chrono::microseconds>(duration)
+              .count(),
+          0,
+          MAX_SAMPLE_US)});
+}
+
+void MutationCostModel::recordSamples(SampleBatch& batch) {
+  if (batch.m_samples.empty()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto previousComponentHandle = batch.m_samples.front().componentHandle;
+    auto* entries = &m_costsByComponentHandle[previousComponentHandle];
+    for (auto const& sample : batch.m_samples) {
+      // consecutive mutations often share the component type
+      if (sample.componentHandle != previousComponentHandle) {
+        previousComponentHandle = sample.componentHandle;
+        entries = &m_costsByComponentHandle[previousComponentHandle];
+      }
+      auto& entry = (*entries)[sample.typeIndex];
+      if (entry.sampleCount < MIN_SAMPLES_FOR_ESTIMATE) {
+        entry.averageUs =
+            (entry.averageUs * entry.sampleCount + sample.durationUs) /
+            (entry.sampleCount + 1);
+        entry.sampleCount++;
+        continue;
+      }
+      entry.averageUs +=
+          (sample.durationUs - entry.averageUs) / EWMA_WEIGHT_DIVISOR;
+    }
+  }
+  batch.m_samples.clear();
+}
+
+int64_t MutationCostModel::estimateCostUs(Mutation const& mutation) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return estimateCostUsLocked(mutation);
+}
+
+std::vector<int64_t> MutationCostModel::estimateCostsUs(
+    facebook::react::ShadowViewMutationList const& mutations) const {
+  std::vector<int64_t> costs;
+  costs.reserve(mutations.size());
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const& mutation : mutations) {
+    costs.push_back(estimateCostUsLocked(mutation));
+  }
+  return costs;
+}
+
+int64_t MutationCostModel::estimateCreateCostUs(
+    ComponentHandle componentHandle) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return estimateCostUsLocked(componentHandle, Mutation::Create);
+}
+
+int64_t MutationCostModel::estimateCostUsLocked(
+    Mutation const& mutation) const {
+  return estimateCostUsLocked(getComponentHandle(mutation), mutation.type);
+}
+
+int64_t MutationCostModel::estimateCostUsLocked(
+    ComponentHandle componentHandle,
+    Mutation::Type type) const {
+  auto it = m_costsByComponentHandle.find(componentHandle);
+  if (it != m_costsByComponentHandle.end()) {
+    auto const& entry = it->second[getTypeIndex(type)];
+    if (entry.sampleCount >= MIN_SAMPLES_FOR_ESTIMATE) {
+      return std::max<int64_t>(entry.averageUs, 1);
+    }
+  }
+  return getDefaultCostUs(type);
+}
+
+size_t MutationCostModel::getTypeIndex(Mutation::Type type) {
+  switch (type) {
+    case Mutation::Create:
+      return 0;
+    case Mutation::Delete:
+      return 1;
+    case Mutation::Insert:
+      return 2;
+    case Mutation::Remove:
+      return 3;
+    case Mutation::Update:
+      return 4;
+    case Mutation::RemoveDeleteTree:
+    default:
+      return 5;
+  }
+}
+
+facebook::react::ComponentHandle MutationCostModel::getComponentHandle(
+    Mutation const& mutation) {
+  switch (mutation.type) {
+    case Mutation::Delete:
+    case Mutation::Remove:
+    case Mutation::RemoveDeleteTree:
+      return mutation.oldChildShadowView.componentHandle;
+    default:
+      return mutation.newChildShadowView.componentHandle;
+  }
+}
+
+int64_t MutationCostModel::getDefaultCostUs(Mutation::Type type) {
+  switch (type) {
+    case Mutation::Create:
+      return DEFAULT_COST_CREATE_US;
+    case Mutation::Insert:
+      return DEFAULT_COST_INSERT_US;
+    case Mutation::Remove:
+      return DEFAULT_COST_REMOVE_US;
+    case Mutation::Delete:
+    case Mutation::RemoveDeleteTree:
+      return DEFAULT_COST_DELETE_US;
+    case Mutation::Update:
+    default:
+      return DEFAULT_COST_UPDATE_US;
+  }
+}
+
+} // namespace rnoh
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace rnoh {
+
+/**
+ * @ThreadSafe
+ *
+ * Learns how long `MountingManager::handleMutation` takes for each
+ * (mutation type, component type) pair. Samples are recorded on the MAIN
+ * thread and on the workers creating detached subtrees, and estimates are
+ * read by the SchedulerDelegate on the background thread to decide how a
+ * transaction is split across frames.
+ */
+class MutationCostModel {
+  using Mutation = facebook::react::ShadowViewMutation;
+  using ComponentHandle = facebook::react::ComponentHandle;
+
+ public:
+  /**
+   * Samples of a batch of mutations, collected without locking by the thread
+   * handling the batch and recorded at once with `recordSamples`.
+   */
+  class SampleBatch {
+   public:
+    explicit SampleBatch(size_t expectedSamplesCount = 0);
+
+    void add(Mutation const& mutation, std::chrono::nanoseconds duration);
+
+   private:
+    friend class MutationCostModel;
+
+    struct Sample {
+      ComponentHandle componentHandle;
+      size_t typeIndex;
+      int64_t durationUs;
+    };
+
+    std::vector<Sample> m_samples;
+  };
+
+  static MutationCostModel& getInstance();
+
+  /**
+   * Folds the samples of `batch` into the estimates and clears it.
+   */
+  void recordSamples(SampleBatch& batch);
+
+  /**
+   * Returns the expected main-thread cost of `mutation` in microseconds.
+   * Falls back to a per-type default until enough samples were recorded
+   * for the component type.
+   */
+  int64_t estimateCostUs(Mutation const& mutation) const;
+
+  /**
+   * Same as `estimateCostUs`, for every mutation in `mutations`, under a single
+   * lock acquisition.
+   */
+  std::vector<int64_t> estimateCostsUs(
+      facebook::react::ShadowViewMutationList const& mutations) const;
+
+  /**
+   * Expected cost of a CREATE mutation of the given component type. Used to
+   * prioritize preallocation before any ShadowView exists.
+   */
+  int64_t estimateCreateCostUs(ComponentHandle componentHandle) const;
+
+ private:
+  // Create, Delete, Insert, Remove, Update, RemoveDeleteTree
+  static constexpr size_t MUTATION_TYPE_COUNT = 6;
+
+  struct CostEntry {
+    int64_t averageUs{0};
+    uint32_t sampleCount{0};
+  };
+
+  using CostEntries = std::array<CostEntry, MUTATION_TYPE_COUNT>;
+
+  MutationCostModel() = default;
+  MutationCostModel(MutationCostModel const&) = delete;
+  MutationCostModel& operator=(MutationCostModel const&) = delete;
+
+  static size_t getTypeIndex(Mutation::Type type);
+  static ComponentHandle getComponentHandle(Mutation const& mutation);
+  static int64_t getDefaultCostUs(Mutation::Type type);
+
+  int64_t estimateCostUsLocked(Mutation const& mutation) const;
+  int64_t estimateCostUsLocked(
+      ComponentHandle componentHandle,
+      Mutation::Type type) const;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<ComponentHandle, CostEntries> m_costsByComponentHandle;
+};
+
+} // namespace rnoh
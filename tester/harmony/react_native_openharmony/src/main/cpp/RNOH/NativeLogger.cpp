@@ -7,12 +7,26 @@
 
 #include "NativeLogger.h"
 #include <hilog/log.h>
+#ifdef ASYNC_LOGGING_ON
+#include "RNOH/AsyncLogWriter.h"
+#endif
 
 #define LOG_DOMAIN 0xBEEF
 #define LOG_TAG "#RNOH_JS"
 #define LOG_PATTERN "__█__ %{public}s"
 
 void rnoh::nativeLogger(const std::string& message, unsigned int logLevel) {
+#ifdef ASYNC_LOGGING_ON
+  LogLevel level = logLevel == 0 ? LOG_DEBUG
+      : logLevel == 2            ? LOG_WARN
+      : logLevel == 3            ? LOG_ERROR
+                                 : LOG_INFO;
+  if (AsyncLogWriter::getInstance().write(level, LOG_TAG, {"__█__ ", message})) {
+    return;
+  }
+  // the line doesn't fit into the buffer, and mustn't overtake queued ones
+  AsyncLogWriter::getInstance().flush();
+#endif
   switch (logLevel) {
     case 0:
       OH_LOG_DEBUG(LOG_APP, LOG_PATTERN, message.c_str());
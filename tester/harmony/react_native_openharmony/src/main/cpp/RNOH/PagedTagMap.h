@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+namespace rnoh {
+
+/**
+ * @ThreadSafe
+ *
+ * Maps tags to shared objects. Fabric tags are small, densely allocated
+ * integers, so values are kept in a lazily allocated, paged flat array
+ * indexed by tag. `find` doesn't take any lock: it checks the slot with an
+ * atomic load and copies the owning reference. Inserts may come from any
+ * thread and are serialized with a mutex. Erasing is reserved to the owner
+ * thread (the one that created the map): after clearing a slot it waits
+ * until no reader on another thread is active (RCU-style grace period)
+ * before dropping the owning reference or an emptied page. Tags that don't
+ * fit into the page table are kept in a mutex-guarded map.
+ *
+ * Only depends on the standard library, so that it can be tested and
+ * benchmarked on a host.
+ */
+template <typename T>
+class PagedTagMap {
+ public:
+  using Tag = int32_t;
+  using Shared = std::shared_ptr<T>;
+
+  static constexpr size_t PAGE_SIZE = 1024;
+  static constexpr size_t MAX_PAGES_COUNT = 4096;
+
+  PagedTagMap()
+      : m_pages(std::make_unique<std::atomic<Page*>[]>(MAX_PAGES_COUNT)) {
+    for (size_t i = 0; i < MAX_PAGES_COUNT; ++i) {
+      m_pages[i].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~PagedTagMap() {
+    for (size_t i = 0; i < MAX_PAGES_COUNT; ++i) {
+      delete m_pages[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  PagedTagMap(PagedTagMap const&) = delete;
+  PagedTagMap& operator=(PagedTagMap const&) = delete;
+
+  static bool isPageable(Tag tag) {
+    return tag >= 0 && static_cast<size_t>(tag) < PAGE_SIZE * MAX_PAGES_COUNT;
+  }
+
+  Shared find(Tag tag) const {
+    if (!isPageable(tag)) {
+      std::lock_guard<std::mutex> lock(m_overflowValueByTagMtx);
+      auto it = m_overflowValueByTag.find(tag);
+      if (it != m_overflowValueByTag.end()) {
+        return it->second;
+      }
+      return nullptr;
+    }
+    auto index = static_cast<size_t>(tag);
+    // values are only erased on the owner thread, so its reads can't overlap
+    // with a grace period and don't need to be tracked
+    std::optional<ReadGuard> readGuard;
+    if (std::this_thread::get_id() != m_ownerThreadId) {
+      readGuard.emplace(m_activeReadersCount);
+    }
+    // seq_cst pairs with the writer clearing the slot before it checks for
+    // active readers
+    auto page = m_pages[index / PAGE_SIZE].load(std::memory_order_seq_cst);
+    if (page == nullptr) {
+      return nullptr;
+    }
+    auto slotIndex = index % PAGE_SIZE;
+    if (page->values[slotIndex].load(std::memory_order_seq_cst) == nullptr) {
+      return nullptr;
+    }
+    // the owner is published before the slot and writers don't touch it
+    // again until the grace period after clearing the slot ends
+    return page->owners[slotIndex];
+  }
+
+  /**
+   * Returns false, leaving the map unchanged, if `tag` is already mapped.
+   */
+  bool insert(Tag tag, Shared value) {
+    if (!isPageable(tag)) {
+      std::lock_guard<std::mutex> lock(m_overflowValueByTagMtx);
+      return m_overflowValueByTag.emplace(tag, std::move(value)).second;
+    }
+    auto index = static_cast<size_t>(tag);
+    std::lock_guard<std::mutex> lock(m_writeMtx);
+    auto& pageSlot = m_pages[index / PAGE_SIZE];
+    auto page = pageSlot.load(std::memory_order_relaxed);
+    if (page == nullptr) {
+      page = new Page();
+      pageSlot.store(page, std::memory_order_release);
+    }
+    auto slotIndex = index % PAGE_SIZE;
+    if (page->owners[slotIndex] != nullptr) {
+      return false;
+    }
+    auto rawValue = value.get();
+    page->owners[slotIndex] = std::move(value);
+    page->values[slotIndex].store(rawValue, std::memory_order_release);
+    page->size++;
+    return true;
+  }
+
+  /**
+   * Must be called on the owner thread. Returns the erased value, or nullptr
+   * if `tag` wasn't mapped.
+   */
+  Shared erase(Tag tag) {
+    if (!isPageable(tag)) {
+      std::lock_guard<std::mutex> lock(m_overflowValueByTagMtx);
+      auto it = m_overflowValueByTag.find(tag);
+      if (it == m_overflowValueByTag.end()) {
+        return nullptr;
+      }
+      auto value = std::move(it->second);
+      m_overflowValueByTag.erase(it);
+      return value;
+    }
+    auto index = static_cast<size_t>(tag);
+    Shared value = nullptr;
+    std::unique_ptr<Page> emptiedPage;
+    {
+      std::lock_guard<std::mutex> lock(m_writeMtx);
+      auto& pageSlot = m_pages[index / PAGE_SIZE];
+      auto page = pageSlot.load(std::memory_order_relaxed);
+      if (page == nullptr) {
+        return nullptr;
+      }
+      auto slotIndex = index % PAGE_SIZE;
+      if (page->owners[slotIndex] == nullptr) {
+        return nullptr;
+      }
+      page->values[slotIndex].store(nullptr, std::memory_order_seq_cst);
+      page->size--;
+      // tags grow monotonically, so an emptied page is usually never needed
+      // again; it's allocated anew if it is
+      if (page->size == 0) {
+        pageSlot.store(nullptr, std::memory_order_seq_cst);
+        emptiedPage.reset(page);
+      }
+      waitForReaders();
+      value = std::move(page->owners[slotIndex]);
+    }
+    return value;
+  }
+
+  std::thread::id getOwnerThreadId() const {
+    return m_ownerThreadId;
+  }
+
+ private:
+  struct Page {
+    std::array<std::atomic<T*>, PAGE_SIZE> values{};
+    // owning references; readers may only copy an owner while its slot in
+    // `values` is set
+    std::array<Shared, PAGE_SIZE> owners{};
+    size_t size = 0;
+  };
+
+  /**
+   * Marks a thread other than the owner as a reader for the lifetime of the
+   * guard.
+   */
+  class ReadGuard {
+   public:
+    explicit ReadGuard(std::atomic<size_t>& activeReadersCount)
+        : m_activeReadersCount(activeReadersCount) {
+      m_activeReadersCount.fetch_add(1, std::memory_order_seq_cst);
+    }
+    ~ReadGuard() {
+      m_activeReadersCount.fetch_sub(1, std::memory_order_release);
+    }
+
+   private:
+    std::atomic<size_t>& m_activeReadersCount;
+  };
+
+  /**
+   * Waits until every reader that could have observed a slot before it was
+   * cleared has finished. Called with `m_writeMtx` held.
+   */
+  void waitForReaders() const {
+    // readers only hold the guard for a couple of atomic operations, so
+    // spinning is cheaper than parking the thread
+    while (m_activeReadersCount.load(std::memory_order_seq_cst) != 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  std::thread::id m_ownerThreadId = std::this_thread::get_id();
+  std::unique_ptr<std::atomic<Page*>[]> m_pages;
+  mutable std::atomic<size_t> m_activeReadersCount{0};
+  std::mutex m_writeMtx;
+  std::unordered_map<Tag, Shared> m_overflowValueByTag;
+  mutable std::mutex m_overflowValueByTagMtx;
+};
+
+} // namespace rnoh
@@ -68,7 +68,13 @@ class HarmonyReactMarker {
     FABRIC_BATCH_EXECUTION_START,
     FABRIC_BATCH_EXECUTION_END,
     FABRIC_UPDATE_UI_MAIN_THREAD_START,
-    FABRIC_UPDATE_UI_MAIN_THREAD_END
+    FABRIC_UPDATE_UI_MAIN_THREAD_END,
+    FABRIC_MUTATION_BATCHING,
+    // JSVM-specific constants below this line
+    JSVM_CODE_CACHE_LOOKUP_START,
+    JSVM_CODE_CACHE_LOOKUP_STOP,
+    // tagged with the size of the found code cache in bytes
+    JSVM_CODE_CACHE_SIZE
   };
 
   class HarmonyReactMarkerListener {
@@ -86,6 +86,9 @@ void OHReactMarkerListener::logMarker(
       logMarkerFinish(
           "FABRIC_UPDATE_UI_MAIN_THREAD", "");
       break;
+    case HarmonyReactMarkerId::FABRIC_MUTATION_BATCHING:
+      logMarker("FABRIC_MUTATION_BATCHING", tag);
+      break;
     case HarmonyReactMarkerId::REACT_BRIDGE_LOADING_START:
       logMarkerStart("REACT_BRIDGE_LOADING", tag);
       break;
@@ -146,6 +149,15 @@ void OHReactMarkerListener::logMarker(
     case HarmonyReactMarkerId::DOWNLOAD_END:
       logMarkerFinish("DOWNLOAD", tag);
       break;  
+    case HarmonyReactMarkerId::JSVM_CODE_CACHE_LOOKUP_START:
+      logMarkerStart("JSVM_CODE_CACHE_LOOKUP", tag);
+      break;
+    case HarmonyReactMarkerId::JSVM_CODE_CACHE_LOOKUP_STOP:
+      logMarkerFinish("JSVM_CODE_CACHE_LOOKUP", tag);
+      break;
+    case HarmonyReactMarkerId::JSVM_CODE_CACHE_SIZE:
+      logMarker("JSVM_CODE_CACHE_SIZE", tag);
+      break;
     case HarmonyReactMarkerId::NATIVE_REQUIRE_START:
     case HarmonyReactMarkerId::NATIVE_REQUIRE_STOP:
       break;
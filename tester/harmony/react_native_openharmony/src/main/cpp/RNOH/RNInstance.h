@@ -17,6 +17,7 @@
 #include <react/renderer/animations/LayoutAnimationDriver.h>
 #include <react/renderer/scheduler/Scheduler.h>
 
+#include "RNOH/AnimatedProps.h"
 #include "RNOH/ArkTSChannel.h"
 #include "RNOH/Assert.h"
 #include "RNOH/EventEmitRequestHandler.h"
@@ -124,6 +125,17 @@ class RNInstance {
   virtual void synchronouslyUpdateViewOnUIThread(
       facebook::react::Tag tag,
       folly::dynamic props) = 0;
+  /**
+   * @internal
+   * Applies typed Animated props without cloning the view's props. Returns
+   * false if they have to be passed to `synchronouslyUpdateViewOnUIThread`
+   * instead.
+   */
+  virtual bool synchronouslyUpdateAnimatedPropsOnUIThread(
+      facebook::react::Tag tag,
+      AnimatedProps const& animatedProps) {
+    return false;
+  }
   virtual void postMessageToArkTS(
       const std::string& name,
       folly::dynamic const& payload) = 0;
@@ -219,7 +231,8 @@ class RNInstanceInternal : public RNInstance,
       std::shared_ptr<facebook::react::JSExecutorFactory> jsExecutorFactory) = 0;
 
     void loadScriptFromBuffer(
-        std::vector<uint8_t> bundle,
+        uint8_t const* bundle,
+        size_t bundleSize,
         std::string const sourceURL,
         std::function<void(const std::string)> onFinish);
     void loadScriptFromFile(
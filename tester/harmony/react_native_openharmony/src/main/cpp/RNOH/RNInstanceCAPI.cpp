@@ -297,6 +297,23 @@ void rnoh::RNInstanceCAPI::synchronouslyUpdateViewOnUIThread(
       tag);
 }
 
+bool rnoh::RNInstanceCAPI::synchronouslyUpdateAnimatedPropsOnUIThread(
+    facebook::react::Tag tag,
+    AnimatedProps const& animatedProps) {
+  RNOH_ASSERT(taskExecutor->getCurrentTaskThread() == TaskThread::MAIN);
+
+  HarmonyReactMarker::logMarker(
+      HarmonyReactMarker::HarmonyReactMarkerId::
+          FABRIC_UPDATE_UI_MAIN_THREAD_START,
+      tag);
+  auto isUpdated = m_mountingManager->updateAnimatedProps(tag, animatedProps);
+  HarmonyReactMarker::logMarker(
+      HarmonyReactMarker::HarmonyReactMarkerId::
+          FABRIC_UPDATE_UI_MAIN_THREAD_END,
+      tag);
+  return isUpdated;
+}
+
 facebook::react::ContextContainer const&
 rnoh::RNInstanceCAPI::getContextContainer() const {
   DLOG(INFO) << "RNInstanceCAPI::getContextContainer";
@@ -404,9 +421,15 @@ void RNInstanceCAPI::createSurface(
           m_componentInstanceRegistry,
           m_componentInstanceFactory,
           m_arkTSMessageHub,
+          m_uiTicker,
           surfaceId,
           m_id,
           moduleName));
+  auto mountingManagerCAPI =
+      std::dynamic_pointer_cast<MountingManagerCAPI>(m_mountingManager);
+  if (mountingManagerCAPI != nullptr) {
+    mountingManagerCAPI->createComponentInstancePool(surfaceId);
+  }
 }
 
 void RNInstanceCAPI::updateSurfaceConstraints(
@@ -597,6 +620,27 @@ void RNInstanceCAPI::destroySurface(facebook::react::Tag surfaceId) {
     return;
   }
   m_surfaceById.erase(it);
+  m_componentInstancePreallocationRequestQueue->setSurfaceVisible(
+      surfaceId, true);
+  auto mountingManagerCAPI =
+      std::dynamic_pointer_cast<MountingManagerCAPI>(m_mountingManager);
+  if (mountingManagerCAPI != nullptr) {
+    mountingManagerCAPI->clearComponentInstancePool(surfaceId);
+  }
+}
+
+void RNInstanceCAPI::setComponentInstancePoolCapacity(
+    facebook::react::Tag surfaceId,
+    size_t capacity) {
+  DLOG(INFO) << "RNInstanceCAPI::setComponentInstancePoolCapacity";
+  auto mountingManagerCAPI =
+      std::dynamic_pointer_cast<MountingManagerCAPI>(m_mountingManager);
+  if (mountingManagerCAPI != nullptr &&
+      !mountingManagerCAPI->setComponentInstancePoolCapacity(
+          surfaceId, capacity)) {
+    LOG(WARNING) << "Can't set the component instance pool capacity of "
+                 << surfaceId << ", the surface doesn't exist";
+  }
 }
 
 void RNInstanceCAPI::setSurfaceDisplayMode(
@@ -608,6 +652,8 @@ void RNInstanceCAPI::setSurfaceDisplayMode(
     return;
   }
   it->second->setDisplayMode(displayMode);
+  m_componentInstancePreallocationRequestQueue->setSurfaceVisible(
+      surfaceId, displayMode == facebook::react::DisplayMode::Visible);
 }
 
 ComponentInstance::Shared RNInstanceCAPI::findComponentInstanceByTag(
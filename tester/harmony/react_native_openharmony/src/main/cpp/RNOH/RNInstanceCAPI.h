@@ -192,6 +192,14 @@ class RNInstanceCAPI : public RNInstanceInternal,
   void setSurfaceDisplayMode(
       facebook::react::Tag surfaceId,
       facebook::react::DisplayMode displayMode) override;
+  /**
+   * Limits how many deleted component instances the surface keeps for reuse.
+   * 0 disables recycling for the surface. Has no effect on surfaces that
+   * weren't created or were already destroyed.
+   */
+  void setComponentInstancePoolCapacity(
+      facebook::react::Tag surfaceId,
+      size_t capacity);
   void callJSFunction(
       std::string&& module,
       std::string&& method,
@@ -212,6 +220,10 @@ class RNInstanceCAPI : public RNInstanceInternal,
       facebook::react::Tag tag,
       folly::dynamic props) override;
 
+  bool synchronouslyUpdateAnimatedPropsOnUIThread(
+      facebook::react::Tag tag,
+      AnimatedProps const& animatedProps) override;
+
   facebook::react::ContextContainer const& getContextContainer() const override;
 
   void attachRootView(
@@ -33,24 +33,15 @@ RNInstanceInternal::RNInstanceInternal(
 }
 
 void RNInstanceInternal::loadScriptFromBuffer(
-    std::vector<uint8_t> bundle,
+    uint8_t const* bundle,
+    size_t bundleSize,
     std::string const sourceURL,
     std::function<void(const std::string)> onFinish) {
-  auto jsBundle = JSBigStringHelpers::fromBuffer(std::move(bundle));
+  // the bundle is copied once, into a null-terminated buffer
+  auto jsBundle = JSBigStringHelpers::fromBuffer(bundle, bundleSize);
   if (jsBundle) {
     DLOG(INFO) << "Loaded bundle from buffer";
   }
-
-  // NOTE: bundle needs to be null terminated to be handled correctly by
-  // hermes. The bundle passed here in an std::vector is not null terminated,
-  // and tightly packed (e.g. bundle.size() == bundle.capacity()), making any
-  // push_back cause a relocation. We cannot avoid a copy, hence we create
-  // another JSBigString whose underlying container is an std::string,
-  // guaranteed to be null-terminated by the standard.
-  if (jsBundle->c_str()[jsBundle->size()] != 0) {
-    jsBundle = std::make_unique<facebook::react::JSBigStdString>(
-        std::string{jsBundle->c_str(), jsBundle->c_str() + jsBundle->size()});
-  }
   this->loadScript(std::move(jsBundle), sourceURL, onFinish);
 }
 
@@ -67,34 +58,15 @@ void RNInstanceInternal::loadScriptFromFile(
 void RNInstanceInternal::loadScriptFromRawFile(
     std::string const rawFileUrl,
     std::function<void(const std::string)> onFinish) {
-  // Magic value used to indicate hermes bytecode
-  const uint64_t hermesMagic = 0x1F1903C103BC1FC6;
   try {
+    // the rawfile is mapped with a null terminator, so both hermes bytecode
+    // and JS source are passed to the engine without copying
     auto jsBundle = JSBigStringHelpers::fromRawFilePath(
         rawFileUrl, m_nativeResourceManager.get());
-    uint64_t extractedMagic{};
-    if (jsBundle->size() >= sizeof(uint64_t)) {
-      const char* source = jsBundle->c_str();
-      std::copy(
-          source,
-          source + sizeof(uint64_t),
-          reinterpret_cast<uint8_t*>(&extractedMagic));
-    }
     if (jsBundle) {
       DLOG(INFO) << "Loaded bundle from rawfile resource";
     }
-    if (extractedMagic == hermesMagic) {
-      this->loadScript(std::move(jsBundle), rawFileUrl, onFinish);
-    } else {
-      // NOTE: bundle needs to be null terminated to be handled correctly by
-      // hermes. Buffers read from a rawfile aren't null terminated, so we
-      // pass the buffer as a string.
-      std::string s(jsBundle->c_str(), jsBundle->c_str() + jsBundle->size());
-      this->loadScript(
-          std::make_unique<facebook::react::JSBigStdString>(std::move(s)),
-          rawFileUrl,
-          onFinish);
-    }
+    this->loadScript(std::move(jsBundle), rawFileUrl, onFinish);
   } catch (const std::runtime_error& e) {
     LOG(ERROR) << e.what();
   }
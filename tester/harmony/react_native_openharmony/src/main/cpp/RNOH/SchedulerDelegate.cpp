@@ -10,10 +10,12 @@
 #include "ParallelCheck.h"
 #include "ParallelComponent.h"
 #include "RNOH/FFRTConfig.h"
+#include "RNOH/MutationCostModel.h"
 #include "RNOH/ParallelCheck.h"
 #include "RNOH/Performance/HarmonyReactMarker.h"
 #include "ffrt/cpp/pattern/job_partner.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -118,10 +120,10 @@ class NextFrameDispatcher {
   OH_NativeVSync* m_vsync{nullptr};
 };
 
-struct TwoBatchSplit {
+struct FrameBatchSplit {
   bool enabled{false};
-  facebook::react::ShadowViewMutationList batchA;
-  facebook::react::ShadowViewMutationList batchB;
+  int64_t estimatedCostUs{0};
+  std::vector<facebook::react::ShadowViewMutationList> batches;
 };
 
 using SteadyClock = std::chrono::steady_clock;
@@ -130,19 +132,19 @@ using SteadyClock = std::chrono::steady_clock;
 constexpr size_t SURFACE_LOAD_MAX_ENTRIES = 128;
 constexpr int SURFACE_LOAD_TTL_MINUTES = 2;
 
-constexpr size_t NONCREATE_SPLIT_MIN_COUNT = 60;
-constexpr int NONCREATE_SPLIT_MIN_COST = 120;
-
 constexpr size_t GROUPS_RESERVE_HINT = 16;
 constexpr size_t FENCE_RESERVE_HINT = 64;
 
-constexpr size_t TWO_BATCHES = 2;
-
-// Non-create mutation cost weights (rough heuristic).
-constexpr int COST_DEFAULT = 2; // Update / miscellaneous
-constexpr int COST_INSERT = 3;
-constexpr int COST_REMOVE = 3;
-constexpr int COST_DELETE = 4;
+// Main-thread time a single mounting batch may take: half a frame at 120 Hz,
+// leaving the other half for ArkUI layout and rendering.
+constexpr int64_t MUTATION_FRAME_BUDGET_US = 4200;
+// Upper bound on how many frames a single transaction may be spread over.
+// When the groups can't be packed into MAX_FRAME_BATCHES batches of one frame
+// budget, the budget is stretched to the smallest one that packs them.
+constexpr size_t MAX_FRAME_BATCHES = 8;
+// Allow breaking long Insert/Remove runs under the same parent once the
+// current group is this expensive.
+constexpr int64_t SOFT_SAMEPARENT_BREAK_COST_US = 450;
 
 constexpr int64_t CONFIG_CHANGE_SKIP_WINDOW_MS = 3000; // 3s
 // ---------------------------------------------------------------
@@ -229,29 +231,6 @@ static inline bool isInInitialLoadWindow(facebook::react::SurfaceId surfaceId) {
   return isInInitialLoadWindowImpl(surfaceId);
 }
 
-static int estimateNonCreateCostImpl(
-    const facebook::react::ShadowViewMutation& m) {
-  using M = facebook::react::ShadowViewMutation;
-  switch (m.type) {
-    case M::Create:
-      return 0;
-    case M::Insert:
-      return COST_INSERT;
-    case M::Remove:
-      return COST_REMOVE;
-    case M::Delete:
-      return COST_DELETE;
-    case M::Update:
-    default:
-      return COST_DEFAULT;
-  }
-}
-
-static inline int estimateNonCreateCost(
-    const facebook::react::ShadowViewMutation& m) {
-  return estimateNonCreateCostImpl(m);
-}
-
 static facebook::react::Tag getTargetTagImpl(
     const facebook::react::ShadowViewMutation& m) {
   using M = facebook::react::ShadowViewMutation;
@@ -280,13 +259,15 @@ static inline bool isStructuralWithParent(
   return m.type == M::Insert || m.type == M::Remove;
 }
 
-static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
+static FrameBatchSplit splitNonCreateMutationsIntoFrameBatches(
     const facebook::react::ShadowViewMutationList& nonCreate) {
   facebook::react::SystraceSection s(
-      "#RNOH::SchedulerDelegate::splitNonCreateMutationsIntoTwoBatches");
+      "#RNOH::SchedulerDelegate::splitNonCreateMutationsIntoFrameBatches");
 
-  TwoBatchSplit out;
+  FrameBatchSplit out;
   const size_t n = nonCreate.size();
+  const auto costs =
+      rnoh::MutationCostModel::getInstance().estimateCostsUs(nonCreate);
 
   // Pre-scan: used to (1) distinguish real "move" (Remove+Insert) from "delete"
   // (Remove+Delete), and (2) protect Insert+Update chains for the same tag from
@@ -296,10 +277,9 @@ static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
   std::unordered_map<facebook::react::Tag, size_t> lastUpdateIndex;
   lastUpdateIndex.reserve(n);
 
-  int quickTotalCost = 0;
   for (size_t i = 0; i < n; ++i) {
     const auto& m = nonCreate[i];
-    quickTotalCost += estimateNonCreateCost(m);
+    out.estimatedCostUs += costs[i];
 
     using M = facebook::react::ShadowViewMutation;
     const auto tag = getTargetTag(m);
@@ -310,27 +290,25 @@ static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
     }
   }
 
-  // Small & cheap batches don't benefit from extra frame; keep single batch.
-  // (Kept compatible with the original guard, but allow splitting if cost is
-  // high even when n is small.)
-  if (n < NONCREATE_SPLIT_MIN_COUNT &&
-      quickTotalCost < NONCREATE_SPLIT_MIN_COST) {
+  // Transactions that fit into a single frame budget don't benefit from being
+  // spread over multiple frames; keep a single batch.
+  if (out.estimatedCostUs <= MUTATION_FRAME_BUDGET_US) {
     out.enabled = false;
-    out.batchA = nonCreate;
+    out.batches.push_back(nonCreate);
     return out;
   }
 
   struct Group {
     size_t start{0};
     size_t end{0};
-    int cost{0};
+    int64_t cost{0};
   };
 
   std::vector<Group> groups;
   groups.reserve(GROUPS_RESERVE_HINT);
 
   size_t groupStart = 0;
-  int groupCost = 0;
+  int64_t groupCost = 0;
 
   // openMovedTags: tags that have been Removed and are expected to be Inserted
   // later (i.e. Move).
@@ -343,9 +321,6 @@ static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
   std::unordered_map<facebook::react::Tag, size_t> pendingInitTags;
   pendingInitTags.reserve(FENCE_RESERVE_HINT);
 
-  constexpr int SOFT_SAMEPARENT_BREAK_COST =
-      90; // allow breaking long Insert/Remove runs under same parent
-
   auto pushGroup = [&groups, &groupStart, &groupCost](size_t endExclusive) {
     if (endExclusive <= groupStart) {
       return;
@@ -357,7 +332,7 @@ static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
 
   for (size_t i = 0; i < n; ++i) {
     const auto& m = nonCreate[i];
-    groupCost += estimateNonCreateCost(m);
+    groupCost += costs[i];
 
     {
       using M = facebook::react::ShadowViewMutation;
@@ -419,7 +394,7 @@ static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
       const bool boundaryAllowed = openMovedTags.empty() &&
           pendingInitTags.empty() &&
           (!sameParentStructuralBlock ||
-           groupCost >= SOFT_SAMEPARENT_BREAK_COST);
+           groupCost >= SOFT_SAMEPARENT_BREAK_COST_US);
       if (boundaryAllowed) {
         pushGroup(i + 1);
       }
@@ -429,57 +404,174 @@ static TwoBatchSplit splitNonCreateMutationsIntoTwoBatches(
 
   if (groups.size() <= 1) {
     out.enabled = false;
-    out.batchA = nonCreate;
+    out.batches.push_back(nonCreate);
     return out;
   }
 
-  int totalCost = 0;
-  for (const auto& g : groups)
-    totalCost += g.cost;
-
-  if (totalCost < NONCREATE_SPLIT_MIN_COST) {
-    out.enabled = false;
-    out.batchA = nonCreate;
-    return out;
+  // Greedily pack consecutive groups into batches of at most `budget`. A
+  // group that exceeds the budget on its own becomes a batch of its own, as
+  // it can't be split without breaking one of the fences above. Greedy
+  // packing needs the fewest batches for a given budget, and the count only
+  // shrinks as the budget grows.
+  auto packGroups = [&groups](int64_t budget, auto&& onBatchEnd) {
+    int64_t batchCost = 0;
+    for (const auto& g : groups) {
+      if (batchCost > 0 && batchCost + g.cost > budget) {
+        onBatchEnd(g.start);
+        batchCost = 0;
+      }
+      batchCost += g.cost;
+    }
+  };
+  auto countBatches = [&packGroups](int64_t budget) {
+    size_t batchesCount = 1;
+    packGroups(budget, [&batchesCount](size_t) { batchesCount++; });
+    return batchesCount;
+  };
+  // the smallest budget, not below one frame budget, that needs at most
+  // MAX_FRAME_BATCHES batches
+  auto budget = MUTATION_FRAME_BUDGET_US;
+  if (countBatches(budget) > MAX_FRAME_BATCHES) {
+    auto tooSmallBudget = budget;
+    budget = out.estimatedCostUs;
+    while (budget - tooSmallBudget > 1) {
+      auto middle = tooSmallBudget + (budget - tooSmallBudget) / 2;
+      if (countBatches(middle) > MAX_FRAME_BATCHES) {
+        tooSmallBudget = middle;
+      } else {
+        budget = middle;
+      }
+    }
   }
+  size_t batchStart = 0;
+  packGroups(budget, [&](size_t batchEnd) {
+    out.batches.emplace_back(
+        nonCreate.begin() + batchStart, nonCreate.begin() + batchEnd);
+    batchStart = batchEnd;
+  });
+  out.batches.emplace_back(nonCreate.begin() + batchStart, nonCreate.end());
+
+  out.enabled = out.batches.size() > 1;
+  return out;
+}
+
+struct DetachedCreateSubtree {
+  // Create mutations of the subtree, in transaction order.
+  std::vector<const facebook::react::ShadowViewMutation*> mutations;
+  int64_t estimatedCostUs{0};
+};
+
+struct CreateSubtreePartition {
+  // Sorted by descending estimated cost, so that the most expensive subtrees
+  // are picked up first and the workers finish at roughly the same time.
+  std::vector<DetachedCreateSubtree> subtrees;
+  // Mutations left for the MAIN thread: Creates of components that can't be
+  // created off the MAIN thread, and all other mutations, including every
+  // Insert connecting the nodes created by the workers.
+  facebook::react::ShadowViewMutationList otherCreateMutations;
+  facebook::react::ShadowViewMutationList otherMutations;
+};
+
+static inline bool canCreateOffMainThread(
+    const facebook::react::ShadowViewMutation& m) {
+  return rnoh::parallelComponentHandles.find(
+             m.newChildShadowView.componentHandle) !=
+      rnoh::parallelComponentHandles.end() ||
+      rnoh::ComponentNameManager::getInstance().hasComponentName(
+             m.newChildShadowView.componentName);
+}
 
-  const int target = totalCost / static_cast<int>(TWO_BATCHES);
+/**
+ * Groups the Creates which can run off the MAIN thread by the subtree, fully
+ * created in this transaction, that they belong to, so that a single worker
+ * owns all the component instances of a subtree. Workers only create the
+ * instances and their unattached ArkUI nodes; connecting the nodes mutates
+ * the ArkUI tree, so all Inserts are replayed on MAIN in transaction order.
+ */
+static CreateSubtreePartition partitionCreatesByDetachedSubtree(
+    const facebook::react::ShadowViewMutationList& mutations) {
+  facebook::react::SystraceSection s(
+      "#RNOH::SchedulerDelegate::partitionCreatesByDetachedSubtree");
+  using M = facebook::react::ShadowViewMutation;
+  using Tag = facebook::react::Tag;
+
+  CreateSubtreePartition out;
+  const size_t n = mutations.size();
 
-  size_t bestGroupBoundaryIndex = 0;
-  int bestDiff = std::numeric_limits<int>::max();
+  std::unordered_set<Tag> offMainCreatedTags;
+  offMainCreatedTags.reserve(n);
+  for (const auto& m : mutations) {
+    if (m.type == M::Create && canCreateOffMainThread(m)) {
+      offMainCreatedTags.insert(m.newChildShadowView.tag);
+    }
+  }
 
-  int prefixCost = 0;
-  for (size_t k = 1; k < groups.size(); ++k) {
-    prefixCost += groups[k - 1].cost;
-    const int diff = std::abs(prefixCost - target);
-    if (diff < bestDiff) {
-      bestDiff = diff;
-      bestGroupBoundaryIndex = k;
+  // Inserts between nodes created off MAIN only decide which subtree a node
+  // belongs to; they are still run on MAIN.
+  std::unordered_map<Tag, Tag> parentTagByTag;
+  parentTagByTag.reserve(offMainCreatedTags.size());
+  for (const auto& m : mutations) {
+    if (m.type == M::Insert &&
+        offMainCreatedTags.count(m.parentShadowView.tag) > 0 &&
+        offMainCreatedTags.count(m.newChildShadowView.tag) > 0) {
+      parentTagByTag[m.newChildShadowView.tag] = m.parentShadowView.tag;
     }
   }
 
-  size_t splitIndex = groups[bestGroupBoundaryIndex - 1].end;
-  if (splitIndex == 0 || splitIndex >= n) {
-    if (n >= TWO_BATCHES) {
-      splitIndex = n / TWO_BATCHES;
-      if (splitIndex == 0) {
-        splitIndex = 1;
+  std::unordered_map<Tag, Tag> rootTagByTag;
+  rootTagByTag.reserve(offMainCreatedTags.size());
+  auto findRootTag = [&parentTagByTag, &rootTagByTag](Tag tag) {
+    std::vector<Tag> path;
+    auto current = tag;
+    while (true) {
+      auto cached = rootTagByTag.find(current);
+      if (cached != rootTagByTag.end()) {
+        current = cached->second;
+        break;
       }
-      if (splitIndex >= n) {
-        splitIndex = n - 1;
+      auto parent = parentTagByTag.find(current);
+      if (parent == parentTagByTag.end()) {
+        break;
       }
-    } else {
-      out.enabled = false;
-      out.batchA = nonCreate;
-      return out;
+      path.push_back(current);
+      current = parent->second;
+    }
+    for (auto visited : path) {
+      rootTagByTag[visited] = current;
     }
+    return current;
+  };
+
+  const auto costs =
+      rnoh::MutationCostModel::getInstance().estimateCostsUs(mutations);
+  std::unordered_map<Tag, size_t> subtreeIndexByRootTag;
+  for (size_t i = 0; i < n; ++i) {
+    const auto& m = mutations[i];
+    if (m.type != M::Create) {
+      out.otherMutations.push_back(m);
+      continue;
+    }
+    if (offMainCreatedTags.count(m.newChildShadowView.tag) == 0) {
+      out.otherCreateMutations.push_back(m);
+      continue;
+    }
+    auto rootTag = findRootTag(m.newChildShadowView.tag);
+    auto [it, inserted] =
+        subtreeIndexByRootTag.try_emplace(rootTag, out.subtrees.size());
+    if (inserted) {
+      out.subtrees.emplace_back();
+    }
+    auto& subtree = out.subtrees[it->second];
+    subtree.mutations.push_back(&m);
+    subtree.estimatedCostUs += costs[i];
   }
 
-  out.enabled = true;
-  out.batchA = facebook::react::ShadowViewMutationList(
-      nonCreate.begin(), nonCreate.begin() + splitIndex);
-  out.batchB = facebook::react::ShadowViewMutationList(
-      nonCreate.begin() + splitIndex, nonCreate.end());
+  std::stable_sort(
+      out.subtrees.begin(),
+      out.subtrees.end(),
+      [](const auto& lhs, const auto& rhs) {
+        return lhs.estimatedCostUs > rhs.estimatedCostUs;
+      });
   return out;
 }
 
@@ -535,15 +627,6 @@ void SchedulerDelegate::schedulerDidFinishTransaction(
         const bool disableParallelForModal =
             !shouldDisableSchedulerParallelForModalFold() &&
             (deviceType() != "phone");
-        auto performOnMainThreadNextFrame =
-            [this](std::function<void(MountingManager::Shared const&)> task) {
-              NextFrameDispatcher::Get().post(
-                  [this, t = std::move(task)]() mutable {
-                    facebook::react::SystraceSection s(
-                        "#RNOH::SchedulerDelegate::onNextFrame");
-                    this->performOnMainThread(std::move(t));
-                  });
-            };
 
         if (IsParallelizationWorkable()) {
           facebook::react::SystraceSection s(
@@ -555,31 +638,49 @@ void SchedulerDelegate::schedulerDidFinishTransaction(
                       ffrt::job_partner_attr()
                           .max_parallelism(MAX_THREAD_NUM_MUTATION_CREATE)
                           .qos(THREAD_PRIORITY_LEVEL_5));
-          ShadowViewMutationList otherCreateMutationList;
-          ShadowViewMutationList otherMutationList;
-
-          for (uint64_t i = 0; i < transaction->getMutations().size(); ++i) {
-            auto const& mutation = transaction->getMutations()[i];
-            if (mutation.type == facebook::react::ShadowViewMutation::Create) {
-              if (parallelComponentHandles.find(
-                      mutation.newChildShadowView.componentHandle) !=
-                      parallelComponentHandles.end() ||
-                  ComponentNameManager::getInstance().hasComponentName(
-                      mutation.newChildShadowView.componentName)) {
-                job_partner->submit([this, &mutation] {
+          auto partition =
+              partitionCreatesByDetachedSubtree(transaction->getMutations());
+          ShadowViewMutationList otherCreateMutationList =
+              std::move(partition.otherCreateMutations);
+          ShadowViewMutationList otherMutationList =
+              std::move(partition.otherMutations);
+
+          // Each worker claims whole subtrees until none are left, so a
+          // subtree is only ever touched by a single thread and idle workers
+          // keep picking up work instead of waiting on a fixed assignment.
+          std::atomic<size_t> nextSubtreeIndex{0};
+          const auto workersCount = std::min<size_t>(
+              MAX_THREAD_NUM_MUTATION_CREATE, partition.subtrees.size());
+          for (size_t w = 0; w < workersCount; ++w) {
+            job_partner->submit([this, &partition, &nextSubtreeIndex] {
+              auto mountingManager = this->m_mountingManager.lock();
+              if (mountingManager == nullptr) {
+                return;
+              }
+              MutationCostModel::SampleBatch costSamples;
+              while (true) {
+                auto subtreeIndex = nextSubtreeIndex.fetch_add(
+                    1, std::memory_order_relaxed);
+                if (subtreeIndex >= partition.subtrees.size()) {
+                  break;
+                }
+                auto startTime = std::chrono::steady_clock::now();
+                for (auto mutation :
+                     partition.subtrees[subtreeIndex].mutations) {
                   try {
-                    this->m_mountingManager.lock()->handleMutation(mutation);
+                    mountingManager->handleMutation(*mutation);
+                    auto endTime = std::chrono::steady_clock::now();
+                    costSamples.add(*mutation, endTime - startTime);
+                    startTime = endTime;
                   } catch (std::exception const& e) {
-                    LOG(ERROR) << "Mutation " << mutation.type
+                    LOG(ERROR) << "Mutation " << mutation->type
                                << " failed: " << e.what();
+                    startTime = std::chrono::steady_clock::now();
                   }
-                });
-              } else {
-                otherCreateMutationList.push_back(mutation);
+                }
               }
-            } else {
-              otherMutationList.push_back(mutation);
-            }
+              MutationCostModel::getInstance().recordSamples(costSamples);
+            });
           }
           job_partner->wait();
 
@@ -620,28 +721,25 @@ void SchedulerDelegate::schedulerDidFinishTransaction(
             return;
           }
 
-          auto split = splitNonCreateMutationsIntoTwoBatches(otherMutationList);
+          auto split = splitNonCreateMutationsIntoFrameBatches(otherMutationList);
+          logMutationBatchingTelemetryMarkers(
+              otherMutationList.size(),
+              split.batches.size(),
+              split.estimatedCostUs);
           if (split.enabled) {
-            auto batchA = std::move(split.batchA);
-            auto batchB = std::move(split.batchB);
-
+            auto batches =
+                std::make_shared<std::vector<ShadowViewMutationList>>(
+                    std::move(split.batches));
             performOnMainThread(
-                [batchA, this](MountingManager::Shared const& mountingManager) {
-                  facebook::react::SystraceSection s(
-                      "#RNOH::SchedulerDelegate::other-nonCreate-A size:",
-                      batchA.size());
-                  mountingManager->didMount(batchA);
-                });
-            performOnMainThreadNextFrame(
-                [transaction, batchB, this](
+                [batches, transaction, this](
                     MountingManager::Shared const& mountingManager) {
                   facebook::react::SystraceSection s(
-                      "#RNOH::SchedulerDelegate::other-nonCreate-B size:",
-                      batchB.size());
-                  mountingManager->didMount(batchB);
-                  mountingManager->finalizeMutationUpdates(
-                      transaction->getMutations());
-                  mountingManager->clearPreallocatedViews();
+                      "#RNOH::SchedulerDelegate::other-nonCreate batch:",
+                      0,
+                      " size:",
+                      batches->front().size());
+                  mountingManager->didMount(batches->front());
+                  performMutationBatchesFrameByFrame(batches, 1, transaction);
                 });
           } else {
             performOnMainThread(
@@ -667,10 +765,6 @@ void SchedulerDelegate::schedulerDidFinishTransaction(
         auto mutationVecs = transaction->getMutations();
         facebook::react::ShadowViewMutationList mutationVec;
         facebook::react::ShadowViewMutationList otherMutation;
-        // The reason for using 70 here is that the average time for each
-        // mutation creation is about 60 microseconds,and the time for 70 is 4.2
-        // milliseconds, which corresponds to the length of half a frame
-        size_t fragmentSize = 70;
         std::vector<facebook::react::ShadowViewMutationList> destVec;
         auto it = mutationVecs.begin();
         while (it != mutationVecs.end()) {
@@ -683,12 +777,28 @@ void SchedulerDelegate::schedulerDidFinishTransaction(
         }
         size_t mutationSize = mutationVec.size();
         if (mutationSize > 0) {
-          destVec.reserve((mutationSize + fragmentSize - 1) / fragmentSize);
-          for (size_t i = 0; i < mutationSize; i += fragmentSize) {
-            destVec.emplace_back(
-                mutationVec.begin() + i,
-                mutationVec.begin() + std::min(mutationSize, i + fragmentSize));
+          // Creates are posted in chunks of about one frame budget of
+          // estimated work, so that other MAIN thread tasks can run in between.
+          const auto costs =
+              MutationCostModel::getInstance().estimateCostsUs(mutationVec);
+          int64_t totalCost = 0;
+          size_t chunkStart = 0;
+          int64_t chunkCost = 0;
+          for (size_t i = 0; i < mutationSize; ++i) {
+            if (chunkCost > 0 &&
+                chunkCost + costs[i] > MUTATION_FRAME_BUDGET_US) {
+              destVec.emplace_back(
+                  mutationVec.begin() + chunkStart, mutationVec.begin() + i);
+              chunkStart = i;
+              chunkCost = 0;
+            }
+            chunkCost += costs[i];
+            totalCost += costs[i];
           }
+          destVec.emplace_back(
+              mutationVec.begin() + chunkStart, mutationVec.end());
+          logMutationBatchingTelemetryMarkers(
+              mutationSize, destVec.size(), totalCost);
           for (const auto& mutations : destVec) {
             performOnMainThread(
                 [mutations,
@@ -763,8 +873,47 @@ void SchedulerDelegate::logTransactionTelemetryMarkers(
       layoutEndTime);
 }
 
+void SchedulerDelegate::logMutationBatchingTelemetryMarkers(
+    size_t mutationsCount,
+    size_t batchesCount,
+    int64_t estimatedCostUs) {
+  auto tag = "mutations:" + std::to_string(mutationsCount) +
+      ";batches:" + std::to_string(batchesCount) +
+      ";estimatedCostUs:" + std::to_string(estimatedCostUs);
+  HarmonyReactMarker::logMarker(
+      HarmonyReactMarker::HarmonyReactMarkerId::FABRIC_MUTATION_BATCHING,
+      tag.c_str());
+}
+
+void SchedulerDelegate::performMutationBatchesFrameByFrame(
+    std::shared_ptr<std::vector<ShadowViewMutationList>> batches,
+    size_t batchIndex,
+    std::shared_ptr<MountingTransaction> transaction) {
+  NextFrameDispatcher::Get().post([this,
+                                   batches = std::move(batches),
+                                   batchIndex,
+                                   transaction = std::move(transaction)] {
+    facebook::react::SystraceSection s("#RNOH::SchedulerDelegate::onNextFrame");
+    performOnMainThread([this, batches, batchIndex, transaction](
+                            MountingManager::Shared const& mountingManager) {
+      facebook::react::SystraceSection s(
+          "#RNOH::SchedulerDelegate::other-nonCreate batch:",
+          batchIndex,
+          " size:",
+          (*batches)[batchIndex].size());
+      mountingManager->didMount((*batches)[batchIndex]);
+      if (batchIndex + 1 < batches->size()) {
+        performMutationBatchesFrameByFrame(batches, batchIndex + 1, transaction);
+        return;
+      }
+      mountingManager->finalizeMutationUpdates(transaction->getMutations());
+      mountingManager->clearPreallocatedViews();
+    });
+  });
+}
+
 void SchedulerDelegate::schedulerDidRequestPreliminaryViewAllocation(
-    SurfaceId /*surfaceId*/,
+    SurfaceId surfaceId,
     const ShadowNode& shadowNode) {
   auto preallocationRequestQueue = m_weakPreallocationRequestQueue.lock();
   if (preallocationRequestQueue == nullptr) {
@@ -775,7 +924,8 @@ void SchedulerDelegate::schedulerDidRequestPreliminaryViewAllocation(
           shadowNode.getTag(),
           shadowNode.getComponentHandle(),
           shadowNode.getComponentName(),
-          shadowNode.getProps()});
+          shadowNode.getProps(),
+          surfaceId});
 }
 
 void SchedulerDelegate::schedulerDidDispatchCommand(
@@ -45,7 +45,7 @@ class SchedulerDelegate final : public facebook::react::SchedulerDelegate {
   static void notifyModalVisibilityChanged(bool visible);
 
   void schedulerDidRequestPreliminaryViewAllocation(
-      SurfaceId /*surfaceId*/,
+      SurfaceId surfaceId,
       const ShadowNode& shadowView) override;
 
   void schedulerDidFinishTransaction(
@@ -79,6 +79,21 @@ class SchedulerDelegate final : public facebook::react::SchedulerDelegate {
   }
   static void logTransactionTelemetryMarkers(
       facebook::react::MountingTransaction const& transaction);
+  static void logMutationBatchingTelemetryMarkers(
+      size_t mutationsCount,
+      size_t batchesCount,
+      int64_t estimatedCostUs);
+
+  /**
+   * Mounts `batches[batchIndex]` on the next frame and chains the remaining
+   * batches onto the frames after it. The last batch finalizes the
+   * transaction.
+   */
+  void performMutationBatchesFrameByFrame(
+      std::shared_ptr<std::vector<facebook::react::ShadowViewMutationList>>
+          batches,
+      size_t batchIndex,
+      std::shared_ptr<facebook::react::MountingTransaction> transaction);
 
   MountingManager::Weak m_mountingManager;
   TaskExecutor::Shared m_taskExecutor;
@@ -7,6 +7,7 @@
 
 #include "EventLoopTaskRunner.h"
 #include <glog/logging.h>
+#include <hitrace/trace.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include "RNOH/Assert.h"
 #include "RNOH/RNOHError.h"
@@ -20,7 +21,9 @@ EventLoopTaskRunner::EventLoopTaskRunner(
       m_loop(loop),
       m_asyncHandle(
           std::make_unique<uv::Async>(m_loop, [this] { this->executeTask(); })),
-      m_exceptionHandler(std::move(exceptionHandler)) {}
+      m_exceptionHandler(std::move(exceptionHandler)) {
+  m_queueDepthTraceName = "#RNOH::TaskRunner::" + m_name + "::queueDepth";
+}
 
 EventLoopTaskRunner::~EventLoopTaskRunner() {
   DLOG(INFO) << "EventLoopTaskRunner::~EventLoopTaskRunner()";
@@ -32,7 +35,7 @@ EventLoopTaskRunner::~EventLoopTaskRunner() {
 void EventLoopTaskRunner::runAsyncTask(Task&& task) {
   {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_asyncTaskQueue.push(std::move(task));
+    m_asyncTaskQueue.push(makeQueuedTask(std::move(task)));
     m_asyncHandle->send();
   }
 }
@@ -96,38 +99,113 @@ void EventLoopTaskRunner::setThreadId(std::thread::id threadId) {
   m_threadId = threadId;
 }
 
+void EventLoopTaskRunner::setTaskQuantum(
+    std::chrono::microseconds taskQuantum) {
+  m_taskQuantum.store(taskQuantum, std::memory_order_relaxed);
+}
+
+void EventLoopTaskRunner::setMetricsEnabled(bool isEnabled) {
+  m_isMetricsEnabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+auto EventLoopTaskRunner::getMetrics() const -> Metrics {
+  return {
+      .queueDepth = m_queueDepthHistogram.getCounts(),
+      .taskLatencyUs = m_taskLatencyUsHistogram.getCounts(),
+      .wakeupsCount = m_wakeupsCount.load(std::memory_order_relaxed),
+      .tasksCount = m_tasksCount.load(std::memory_order_relaxed),
+  };
+}
+
 void EventLoopTaskRunner::executeTask() {
-  Task task = popNextTask();
-  if (task) {
-    try {
-      facebook::react::SystraceSection s("#RNOH::TaskRunner::task");
-      task();
-      // ensure the resources captured by the task are cleaned up
-      task = nullptr;
-    } catch (...) {
-      m_exceptionHandler(std::current_exception());
+  auto deadline =
+      Clock::now() + m_taskQuantum.load(std::memory_order_relaxed);
+  if (!takeQueuedTasks()) {
+    return;
+  }
+  auto queueDepth = m_pendingSyncTasks.size() + m_pendingAsyncTasks.size();
+  if (m_isMetricsEnabled.load(std::memory_order_relaxed)) {
+    m_wakeupsCount.fetch_add(1, std::memory_order_relaxed);
+    m_queueDepthHistogram.record(queueDepth);
+  }
+#ifdef WITH_HITRACE_SYSTRACE
+  OH_HiTrace_CountTrace(m_queueDepthTraceName.c_str(), queueDepth);
+#endif
+
+  while (true) {
+    // a thread may be blocked on a sync task queued while this batch runs
+    if (m_hasQueuedSyncTasks.load(std::memory_order_relaxed) &&
+        !takeQueuedTasks()) {
+      break;
+    }
+    auto& tasks = m_pendingSyncTasks.empty() ? m_pendingAsyncTasks
+                                             : m_pendingSyncTasks;
+    if (tasks.empty()) {
+      break;
+    }
+    auto queuedTask = std::move(tasks.front());
+    tasks.pop();
+    runTask(queuedTask);
+    // the task may have stopped the runner (see `cleanup`)
+    if (!m_running || Clock::now() >= deadline) {
+      break;
     }
   }
+
+  if (!m_running) {
+    // `cleanup` already dropped the pending tasks
+    return;
+  }
   std::lock_guard<std::mutex> lock(m_mutex);
-  if (!m_syncTaskQueue.empty() || !m_asyncTaskQueue.empty()) {
+  if (!m_pendingSyncTasks.empty() || !m_pendingAsyncTasks.empty() ||
+      !m_syncTaskQueue.empty() || !m_asyncTaskQueue.empty()) {
     m_asyncHandle->send();
   }
 }
 
-auto EventLoopTaskRunner::popNextTask() -> Task {
-  std::lock_guard<std::mutex> queueLock(m_mutex);
-  Task task{};
-  if (!m_running) {
-    return {};
+bool EventLoopTaskRunner::takeQueuedTasks() {
+  TaskQueue syncTasks;
+  TaskQueue asyncTasks;
+  {
+    std::lock_guard<std::mutex> queueLock(m_mutex);
+    if (!m_running) {
+      return false;
+    }
+    syncTasks.swap(m_syncTaskQueue);
+    asyncTasks.swap(m_asyncTaskQueue);
+    m_hasQueuedSyncTasks.store(false, std::memory_order_relaxed);
   }
-  if (!m_syncTaskQueue.empty()) {
-    task = std::move(m_syncTaskQueue.front());
-    m_syncTaskQueue.pop();
-  } else if (!m_asyncTaskQueue.empty()) {
-    task = std::move(m_asyncTaskQueue.front());
-    m_asyncTaskQueue.pop();
+  auto append = [](TaskQueue& pendingTasks, TaskQueue& tasks) {
+    if (pendingTasks.empty()) {
+      pendingTasks.swap(tasks);
+      return;
+    }
+    while (!tasks.empty()) {
+      pendingTasks.push(std::move(tasks.front()));
+      tasks.pop();
+    }
+  };
+  append(m_pendingSyncTasks, syncTasks);
+  append(m_pendingAsyncTasks, asyncTasks);
+  return true;
+}
+
+void EventLoopTaskRunner::runTask(QueuedTask& queuedTask) {
+  if (queuedTask.queuedAt != Clock::time_point{}) {
+    m_tasksCount.fetch_add(1, std::memory_order_relaxed);
+    m_taskLatencyUsHistogram.record(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - queuedTask.queuedAt)
+            .count());
+  }
+  try {
+    facebook::react::SystraceSection s("#RNOH::TaskRunner::task");
+    queuedTask.task();
+    // ensure the resources captured by the task are cleaned up
+    queuedTask.task = nullptr;
+  } catch (...) {
+    m_exceptionHandler(std::current_exception());
   }
-  return task;
 }
 
 void EventLoopTaskRunner::waitForSyncTask(Task&& task) {
@@ -151,13 +229,21 @@ void EventLoopTaskRunner::waitForSyncTask(Task&& task) {
 
   {
     std::unique_lock<std::mutex> queueLock(m_mutex);
-    m_syncTaskQueue.push(std::move(wrappedTask));
+    m_syncTaskQueue.push(makeQueuedTask(std::move(wrappedTask)));
+    m_hasQueuedSyncTasks.store(true, std::memory_order_relaxed);
     m_asyncHandle->send();
   }
   auto doneLock = std::unique_lock(mtx);
   cv.wait(doneLock, [this, &done] { return done.load(); });
 }
 
+auto EventLoopTaskRunner::makeQueuedTask(Task&& task) const -> QueuedTask {
+  auto queuedAt = m_isMetricsEnabled.load(std::memory_order_relaxed)
+      ? Clock::now()
+      : Clock::time_point{};
+  return {std::move(task), queuedAt};
+}
+
 void EventLoopTaskRunner::cleanup() {
   if (cleanedUp) {
     return;
@@ -167,9 +253,10 @@ void EventLoopTaskRunner::cleanup() {
     m_running = false;
     m_asyncHandle.reset();
     RNOH_ASSERT_MSG(
-        m_syncTaskQueue.empty(),
+        m_syncTaskQueue.empty() && m_pendingSyncTasks.empty(),
         "Task runner was destroyed while there were pending sync tasks");
     m_asyncTaskQueue = {};
+    m_pendingAsyncTasks = {};
     m_timerByTaskId.clear();
   });
   cleanedUp = true;
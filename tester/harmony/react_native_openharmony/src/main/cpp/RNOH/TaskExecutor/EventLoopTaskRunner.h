@@ -8,6 +8,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <queue>
@@ -15,13 +16,31 @@
 #include <unordered_map>
 #include "AbstractTaskRunner.h"
 #include "DefaultExceptionHandler.h"
+#include "TaskRunnerHistogram.h"
 #include "uv/Async.h"
 #include "uv/EventLoop.h"
 #include "uv/Timer.h"
 
 namespace rnoh {
+/**
+ * Runs tasks on a libuv event loop. Every wakeup takes all queued tasks at
+ * once and runs them until the task quantum is used up; the rest is run on
+ * the next wakeup, so the loop can still service its other handles. Sync
+ * tasks are run before async ones.
+ */
 class EventLoopTaskRunner : public AbstractTaskRunner {
  public:
+  static constexpr std::chrono::microseconds DEFAULT_TASK_QUANTUM{4000};
+
+  struct Metrics {
+    // tasks waiting to be run when the loop wakes up
+    TaskRunnerHistogram::Counts queueDepth;
+    // time between queueing a task and running it, in microseconds
+    TaskRunnerHistogram::Counts taskLatencyUs;
+    uint64_t wakeupsCount;
+    uint64_t tasksCount;
+  };
+
   EventLoopTaskRunner(
       std::string name,
       uv_loop_t* loop,
@@ -44,20 +63,62 @@ class EventLoopTaskRunner : public AbstractTaskRunner {
 
   void setThreadId(std::thread::id threadId);
 
+  /**
+   * Limits how long a single wakeup keeps running queued tasks. At least one
+   * task is run per wakeup.
+   */
+  void setTaskQuantum(std::chrono::microseconds taskQuantum);
+
+  /**
+   * Metrics are off by default, so that queueing a task doesn't read the
+   * clock. Tasks queued while they are off aren't counted in the latency
+   * histogram.
+   */
+  void setMetricsEnabled(bool isEnabled);
+
+  Metrics getMetrics() const;
+
  protected:
+  using Clock = std::chrono::steady_clock;
+
+  struct QueuedTask {
+    Task task;
+    // only set while metrics are enabled
+    Clock::time_point queuedAt{};
+  };
+
+  using TaskQueue = std::queue<QueuedTask>;
+
   virtual void executeTask();
 
-  Task popNextTask();
+  /**
+   * Moves the tasks queued by other threads to the batch run by the current
+   * wakeup. Returns false if the runner is stopped.
+   */
+  bool takeQueuedTasks();
+  virtual void runTask(QueuedTask& queuedTask);
   void waitForSyncTask(Task&& task);
+  QueuedTask makeQueuedTask(Task&& task) const;
   void cleanup();
 
   std::atomic<DelayedTaskId> m_nextTaskId = 0;
   std::string m_name;
   uv_loop_t* m_loop;
   std::atomic_bool m_running{true};
-  std::queue<Task> m_asyncTaskQueue{};
-  std::queue<Task> m_syncTaskQueue{};
+  TaskQueue m_asyncTaskQueue{};
+  TaskQueue m_syncTaskQueue{};
+  std::atomic_bool m_hasQueuedSyncTasks{false};
   std::mutex m_mutex;
+  // tasks taken from the queues but not run yet, only accessed on the loop
+  TaskQueue m_pendingAsyncTasks{};
+  TaskQueue m_pendingSyncTasks{};
+  std::atomic<std::chrono::microseconds> m_taskQuantum{DEFAULT_TASK_QUANTUM};
+  std::string m_queueDepthTraceName;
+  std::atomic_bool m_isMetricsEnabled{false};
+  TaskRunnerHistogram m_queueDepthHistogram;
+  TaskRunnerHistogram m_taskLatencyUsHistogram;
+  std::atomic<uint64_t> m_wakeupsCount{0};
+  std::atomic<uint64_t> m_tasksCount{0};
   std::unique_ptr<uv::Async> m_asyncHandle;
   std::unordered_map<DelayedTaskId, uv::Timer> m_timerByTaskId;
   ExceptionHandler m_exceptionHandler;
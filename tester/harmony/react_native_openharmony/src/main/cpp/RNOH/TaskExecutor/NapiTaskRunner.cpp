@@ -37,22 +37,26 @@ bool NapiTaskRunner::isOnCurrentThread() const {
   return m_threadId == std::this_thread::get_id();
 }
 
-void NapiTaskRunner::executeTask() {
+void NapiTaskRunner::runTask(QueuedTask& queuedTask) {
   RNOH_ASSERT(isOnCurrentThread());
 
   // https://nodejs.org/api/n-api.html#napi_handle_scope
   // "For any invocations of code outside the execution of a native method
   // (...) the module is required to create a scope before invoking any
   // functions that can result in the creation of JavaScript values"
+  // A wakeup may run many tasks, so every task gets its own scope to release
+  // its values as soon as it's done.
   auto env = m_env;
   napi_handle_scope scope;
   auto result = napi_open_handle_scope(env, &scope);
   if (result != napi_ok) {
+    // the task is run anyway, as a thread may be waiting for it
     LOG(ERROR) << "Failed to open handle scope";
+    EventLoopTaskRunner::runTask(queuedTask);
     return;
   }
 
-  EventLoopTaskRunner::executeTask();
+  EventLoopTaskRunner::runTask(queuedTask);
 
   result = napi_close_handle_scope(env, scope);
   if (result != napi_ok) {
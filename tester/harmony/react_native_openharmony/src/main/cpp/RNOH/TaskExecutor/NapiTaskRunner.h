@@ -33,7 +33,7 @@ class NapiTaskRunner : public EventLoopTaskRunner {
   bool isOnCurrentThread() const override;
 
  protected:
-  void executeTask() override;
+  void runTask(QueuedTask& queuedTask) override;
   napi_env m_env;
   uv_loop_t* getLoop(napi_env env) const;
 
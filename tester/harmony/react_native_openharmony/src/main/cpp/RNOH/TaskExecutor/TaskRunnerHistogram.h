@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace rnoh {
+
+/**
+ * @internal
+ * @ThreadSafe
+ *
+ * Histogram with power-of-two buckets: bucket 0 counts zeros and bucket `i`
+ * counts values in [2^(i-1), 2^i). The last bucket also counts everything
+ * above its range. Recording is a single relaxed atomic increment.
+ */
+class TaskRunnerHistogram {
+ public:
+  static constexpr size_t BUCKETS_COUNT = 24;
+
+  using Counts = std::array<uint64_t, BUCKETS_COUNT>;
+
+  void record(uint64_t value) {
+    size_t bucket = 0;
+    if (value != 0) {
+      bucket = std::min<size_t>(64 - __builtin_clzll(value), BUCKETS_COUNT - 1);
+    }
+    m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  Counts getCounts() const {
+    Counts counts{};
+    for (size_t i = 0; i < BUCKETS_COUNT; ++i) {
+      counts[i] = m_counts[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+  }
+
+ private:
+  std::array<std::atomic<uint64_t>, BUCKETS_COUNT> m_counts{};
+};
+
+} // namespace rnoh
@@ -17,6 +17,9 @@ ThreadTaskRunner::ThreadTaskRunner(
   std::condition_variable cv;
   std::unique_lock lock(mtx);
     m_thread = std::thread{[&] {
+    // named before anything runs on the thread, so that its first log lines
+    // already carry its name
+    pthread_setname_np(pthread_self(), name.c_str());
     uv::EventLoop eventLoop;
     {
       std::unique_lock lock(mtx);
@@ -28,8 +31,6 @@ ThreadTaskRunner::ThreadTaskRunner(
     eventLoop.run();
   }};
   cv.wait(lock, [&] { return this->m_wrappedTaskRunner != nullptr; });
-  auto handle = m_thread.native_handle();
-  pthread_setname_np(handle, name.c_str());
 }
 
 ThreadTaskRunner::~ThreadTaskRunner() noexcept(false) {
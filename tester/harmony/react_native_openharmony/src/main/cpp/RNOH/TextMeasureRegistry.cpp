@@ -13,65 +13,302 @@
 
 #include "TextMeasureRegistry.h"
 #include "TextMeasureCache.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace {
+// There's no API to query the memory used by a typography, so it's estimated
+// from the text length and the number of laid out lines: the styled string
+// and the paragraph both keep the text, and shaping stores glyphs, positions
+// and clusters for every UTF-16 unit.
+constexpr size_t TYPOGRAPHY_BASE_BYTES = 2048;
+constexpr size_t TYPOGRAPHY_BYTES_PER_UTF16_UNIT = 48;
+constexpr size_t TYPOGRAPHY_BYTES_PER_LINE = 256;
+} // namespace
+
+size_t TextMeasureInfo::estimateByteSize() const {
+  return TYPOGRAPHY_BASE_BYTES +
+      typography.getUtf16Length() * TYPOGRAPHY_BYTES_PER_UTF16_UNIT +
+      typography.getLineCount() * TYPOGRAPHY_BYTES_PER_LINE;
+}
 
 TextMeasureRegistry& TextMeasureRegistry::getTextMeasureRegistry() {
   static TextMeasureRegistry TextMeasureRegistry;
   return TextMeasureRegistry;
 }
 
-void TextMeasureRegistry::setTextMeasureInfo(const std::string& key, std::shared_ptr<TextMeasureInfo> measureInfo, facebook::react::TextMeasureCacheKey& cacheKey) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_textMeasureInfoCache.set(cacheKey, measureInfo);
-  m_keyToMeasureInfo.erase(key);
-  m_keyToCacheKey.erase(key);
-  m_keyToMeasureInfo.emplace(key, measureInfo);
-  m_keyToCacheKey.emplace(key, cacheKey);
+void TextMeasureRegistry::setTextMeasureInfo(const TextMeasureKey& key, std::shared_ptr<TextMeasureInfo> measureInfo, facebook::react::TextMeasureCacheKey& cacheKey) {
+  {
+    auto& keyShard = getKeyShard(key);
+    std::lock_guard<std::mutex> lock(keyShard.mutex);
+    keyShard.measureInfoByKey.insert_or_assign(key, measureInfo);
+  }
+
+  auto instanceCache = getInstanceCache(key.rnInstanceId);
+  auto shardIndex = getCacheShardIndex(cacheKey);
+  auto& shard = instanceCache->shards[shardIndex];
+  auto byteSize = measureInfo->estimateByteSize();
+  // typographies are destroyed after the shard is unlocked
+  std::shared_ptr<TextMeasureInfo> replaced;
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto itor = shard.entryByCacheKey.find(cacheKey);
+    if (itor != shard.entryByCacheKey.end()) {
+      auto& entry = *itor->second;
+      if (entry.measureInfo != measureInfo) {
+        retainMeasureInfo(*instanceCache, *measureInfo, byteSize);
+        releaseMeasureInfo(*instanceCache, *entry.measureInfo);
+        replaced = std::exchange(entry.measureInfo, std::move(measureInfo));
+      }
+      shard.entries.splice(shard.entries.begin(), shard.entries, itor->second);
+    } else {
+      retainMeasureInfo(*instanceCache, *measureInfo, byteSize);
+      shard.entries.push_front(CacheEntry{cacheKey, std::move(measureInfo)});
+      shard.entryByCacheKey.emplace(cacheKey, shard.entries.begin());
+    }
+  }
+  evictUntilFits(*instanceCache, shardIndex);
 }
 
-ArkUI_StyledString* TextMeasureRegistry::getTextStyledString(const std::string& key) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  auto itor = m_keyToMeasureInfo.find(key);
-  if (itor != m_keyToMeasureInfo.end()) {
+ArkUI_StyledString* TextMeasureRegistry::getTextStyledString(const TextMeasureKey& key) {
+  auto& keyShard = getKeyShard(key);
+  std::lock_guard<std::mutex> lock(keyShard.mutex);
+  auto itor = keyShard.measureInfoByKey.find(key);
+  if (itor != keyShard.measureInfoByKey.end()) {
     return itor->second->builder.getTextStyleString();
   }
   return nullptr;
 }
 
 std::optional<std::shared_ptr<TextMeasureInfo>> TextMeasureRegistry::getTextMeasureInfo(
-    const facebook::react::TextMeasureCacheKey& cacheKey, float scale)
+    int rnInstanceId, const facebook::react::TextMeasureCacheKey& cacheKey, float scale)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  std::optional<std::shared_ptr<TextMeasureInfo>> measureInfo = std::nullopt;
-  auto itor = m_textMeasureInfoCache.find(cacheKey);
-  if (itor != m_textMeasureInfoCache.end()) {
-    if (scale == itor->second->builder.getScale()) {
-        measureInfo = itor->second;
-    }
+  auto instanceCache = getInstanceCache(rnInstanceId);
+  auto& shard = instanceCache->shards[getCacheShardIndex(cacheKey)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto itor = shard.entryByCacheKey.find(cacheKey);
+  if (itor != shard.entryByCacheKey.end() &&
+      scale == itor->second->measureInfo->builder.getScale()) {
+    shard.entries.splice(shard.entries.begin(), shard.entries, itor->second);
+    instanceCache->hits.fetch_add(1, std::memory_order_relaxed);
+    return itor->second->measureInfo;
+  }
+  instanceCache->misses.fetch_add(1, std::memory_order_relaxed);
+  return std::nullopt;
+}
+
+void TextMeasureRegistry::setTextMeasureInfoByWidth(
+    int rnInstanceId, facebook::react::TextMeasureCacheKey widthKey, std::shared_ptr<TextMeasureInfo> measureInfo)
+{
+  auto instanceCache = getInstanceCache(rnInstanceId);
+  auto& shard = getWidthShard(*instanceCache, widthKey);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.measureInfoByWidthKey.insert_or_assign(std::move(widthKey), std::move(measureInfo));
+  if (shard.measureInfoByWidthKey.size() > shard.sweepThreshold) {
+    shard.sweepExpired();
+  }
+}
+
+std::shared_ptr<TextMeasureInfo> TextMeasureRegistry::getTextMeasureInfoByWidth(
+    int rnInstanceId, const facebook::react::TextMeasureCacheKey& widthKey, float scale)
+{
+  auto instanceCache = getInstanceCache(rnInstanceId);
+  auto& shard = getWidthShard(*instanceCache, widthKey);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto itor = shard.measureInfoByWidthKey.find(widthKey);
+  if (itor == shard.measureInfoByWidthKey.end()) {
+    return nullptr;
+  }
+  auto measureInfo = itor->second.lock();
+  if (measureInfo == nullptr) {
+    shard.measureInfoByWidthKey.erase(itor);
+    return nullptr;
+  }
+  if (scale != measureInfo->builder.getScale()) {
+    return nullptr;
   }
   return measureInfo;
 }
 
-std::optional<std::shared_ptr<TextMeasureInfo>> TextMeasureRegistry::getTextMeasureInfoByKey(const std::string& key) {
-  std::lock_guard<std::mutex> lock(m_mutex);
+std::optional<std::shared_ptr<TextMeasureInfo>> TextMeasureRegistry::getTextMeasureInfoByKey(const TextMeasureKey& key) {
+  auto& keyShard = getKeyShard(key);
+  std::lock_guard<std::mutex> lock(keyShard.mutex);
   std::optional<std::shared_ptr<TextMeasureInfo>> measureInfo = std::nullopt;
-  auto itor = m_keyToMeasureInfo.find(key);
-  if (itor != m_keyToMeasureInfo.end()) {
+  auto itor = keyShard.measureInfoByKey.find(key);
+  if (itor != keyShard.measureInfoByKey.end()) {
     measureInfo = itor->second;
   }
   return measureInfo;
 }
 
-void TextMeasureRegistry::eraseTextMeasureInfo(const std::string& key) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  if (m_keyToMeasureInfo.find(key) != m_keyToMeasureInfo.end()) {
-    m_keyToMeasureInfo.erase(key);
-    m_keyToCacheKey.erase(key);
+void TextMeasureRegistry::eraseTextMeasureInfo(const TextMeasureKey& key) {
+  std::shared_ptr<TextMeasureInfo> measureInfo;
+  auto& keyShard = getKeyShard(key);
+  std::lock_guard<std::mutex> lock(keyShard.mutex);
+  auto itor = keyShard.measureInfoByKey.find(key);
+  if (itor != keyShard.measureInfoByKey.end()) {
+    measureInfo = std::move(itor->second);
+    keyShard.measureInfoByKey.erase(itor);
   }
 }
 
 void TextMeasureRegistry::clear() {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_keyToMeasureInfo.clear();
-  m_keyToMeasureInfo.clear();
-  m_textMeasureInfoCache.clear();
-}
\ No newline at end of file
+  // typographies are destroyed after the shards are unlocked
+  std::vector<std::unordered_map<TextMeasureKey, std::shared_ptr<TextMeasureInfo>, TextMeasureKeyHash>> cleared;
+  cleared.reserve(SHARDS_COUNT);
+  for (auto& keyShard : m_keyShards) {
+    std::lock_guard<std::mutex> lock(keyShard.mutex);
+    cleared.push_back(std::move(keyShard.measureInfoByKey));
+    keyShard.measureInfoByKey.clear();
+  }
+  std::unordered_map<int, std::shared_ptr<InstanceCache>> instanceCacheById;
+  {
+    std::shared_lock<std::shared_mutex> lock(m_instanceCacheByIdMutex);
+    instanceCacheById = m_instanceCacheById;
+  }
+  for (auto& [_, instanceCache] : instanceCacheById) {
+    clearInstanceCache(*instanceCache);
+  }
+}
+
+void TextMeasureRegistry::clear(int rnInstanceId) {
+  std::shared_ptr<InstanceCache> instanceCache;
+  {
+    std::unique_lock<std::shared_mutex> lock(m_instanceCacheByIdMutex);
+    auto itor = m_instanceCacheById.find(rnInstanceId);
+    if (itor == m_instanceCacheById.end()) {
+      return;
+    }
+    instanceCache = std::move(itor->second);
+    m_instanceCacheById.erase(itor);
+  }
+  // measure infos may outlive the cache in the key shards, and are charged
+  // again if they get cached by another instance cache
+  clearInstanceCache(*instanceCache);
+}
+
+void TextMeasureRegistry::setMemoryBudget(int rnInstanceId, size_t bytes) {
+  auto instanceCache = getInstanceCache(rnInstanceId);
+  instanceCache->budgetBytes.store(bytes, std::memory_order_relaxed);
+  evictUntilFits(*instanceCache, 0);
+}
+
+TextMeasureRegistry::Stats TextMeasureRegistry::getStats(int rnInstanceId) {
+  auto instanceCache = getInstanceCache(rnInstanceId);
+  Stats stats{};
+  stats.hits = instanceCache->hits.load(std::memory_order_relaxed);
+  stats.misses = instanceCache->misses.load(std::memory_order_relaxed);
+  stats.evictions = instanceCache->evictions.load(std::memory_order_relaxed);
+  stats.bytes = instanceCache->bytes.load(std::memory_order_relaxed);
+  for (auto& shard : instanceCache->shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    stats.entries += shard.entries.size();
+  }
+  return stats;
+}
+
+void TextMeasureRegistry::clearInstanceCache(InstanceCache& instanceCache) {
+  for (auto& shard : instanceCache.shards) {
+    std::list<CacheEntry> entries;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (auto& entry : shard.entries) {
+      releaseMeasureInfo(instanceCache, *entry.measureInfo);
+    }
+    entries.swap(shard.entries);
+    shard.entryByCacheKey.clear();
+  }
+  for (auto& widthShard : instanceCache.widthShards) {
+    std::lock_guard<std::mutex> lock(widthShard.mutex);
+    widthShard.measureInfoByWidthKey.clear();
+    widthShard.sweepThreshold = WidthShard::MIN_SWEEP_THRESHOLD;
+  }
+}
+
+void TextMeasureRegistry::evictUntilFits(InstanceCache& instanceCache, size_t firstShardIndex) {
+  auto isOverBudget = [&instanceCache] {
+    return instanceCache.bytes.load(std::memory_order_relaxed) >
+        instanceCache.budgetBytes.load(std::memory_order_relaxed);
+  };
+  // the shards are locked one at a time, so that concurrent evictions
+  // starting from different shards can't deadlock
+  for (size_t i = 0; i < SHARDS_COUNT && isOverBudget(); i++) {
+    auto& shard = instanceCache.shards[(firstShardIndex + i) % SHARDS_COUNT];
+    // the most recent entry is kept even if it exceeds the budget on its own
+    size_t keptEntriesCount = i == 0 ? 1 : 0;
+    // typographies are destroyed after the shard is unlocked
+    std::list<CacheEntry> evicted;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    while (isOverBudget() && shard.entries.size() > keptEntriesCount) {
+      auto lastEntry = std::prev(shard.entries.end());
+      shard.entryByCacheKey.erase(lastEntry->cacheKey);
+      releaseMeasureInfo(instanceCache, *lastEntry->measureInfo);
+      evicted.splice(evicted.end(), shard.entries, lastEntry);
+      instanceCache.evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+void TextMeasureRegistry::retainMeasureInfo(InstanceCache& instanceCache, const TextMeasureInfo& measureInfo, size_t byteSize) {
+  auto& chargeShard = instanceCache.chargeShards[std::hash<const TextMeasureInfo*>{}(&measureInfo) % SHARDS_COUNT];
+  std::lock_guard<std::mutex> lock(chargeShard.mutex);
+  auto [itor, isNew] = chargeShard.chargeByMeasureInfo.try_emplace(&measureInfo, Charge{0, byteSize});
+  if (isNew) {
+    instanceCache.bytes.fetch_add(byteSize, std::memory_order_relaxed);
+  }
+  itor->second.entriesCount++;
+}
+
+void TextMeasureRegistry::releaseMeasureInfo(InstanceCache& instanceCache, const TextMeasureInfo& measureInfo) {
+  auto& chargeShard = instanceCache.chargeShards[std::hash<const TextMeasureInfo*>{}(&measureInfo) % SHARDS_COUNT];
+  std::lock_guard<std::mutex> lock(chargeShard.mutex);
+  auto itor = chargeShard.chargeByMeasureInfo.find(&measureInfo);
+  if (itor == chargeShard.chargeByMeasureInfo.end()) {
+    return;
+  }
+  if (--itor->second.entriesCount == 0) {
+    instanceCache.bytes.fetch_sub(itor->second.byteSize, std::memory_order_relaxed);
+    chargeShard.chargeByMeasureInfo.erase(itor);
+  }
+}
+
+void TextMeasureRegistry::WidthShard::sweepExpired() {
+  for (auto itor = measureInfoByWidthKey.begin(); itor != measureInfoByWidthKey.end();) {
+    if (itor->second.expired()) {
+      itor = measureInfoByWidthKey.erase(itor);
+    } else {
+      ++itor;
+    }
+  }
+  // sweeping again only after the live entries double keeps inserts amortized O(1)
+  sweepThreshold = std::max(MIN_SWEEP_THRESHOLD, measureInfoByWidthKey.size() * 2);
+}
+
+std::shared_ptr<TextMeasureRegistry::InstanceCache> TextMeasureRegistry::getInstanceCache(int rnInstanceId) {
+  {
+    std::shared_lock<std::shared_mutex> lock(m_instanceCacheByIdMutex);
+    auto itor = m_instanceCacheById.find(rnInstanceId);
+    if (itor != m_instanceCacheById.end()) {
+      return itor->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(m_instanceCacheByIdMutex);
+  auto& instanceCache = m_instanceCacheById[rnInstanceId];
+  if (instanceCache == nullptr) {
+    instanceCache = std::make_shared<InstanceCache>();
+  }
+  return instanceCache;
+}
+
+size_t TextMeasureRegistry::getCacheShardIndex(const facebook::react::TextMeasureCacheKey& cacheKey) {
+  return std::hash<facebook::react::TextMeasureCacheKey>{}(cacheKey) % SHARDS_COUNT;
+}
+
+TextMeasureRegistry::WidthShard& TextMeasureRegistry::getWidthShard(InstanceCache& instanceCache, const facebook::react::TextMeasureCacheKey& widthKey) {
+  auto hash = std::hash<facebook::react::TextMeasureCacheKey>{}(widthKey);
+  return instanceCache.widthShards[hash % SHARDS_COUNT];
+}
+
+TextMeasureRegistry::KeyShard& TextMeasureRegistry::getKeyShard(const TextMeasureKey& key) {
+  return m_keyShards[key.hash % SHARDS_COUNT];
+}
@@ -14,45 +14,195 @@
 #ifndef HARMONY_TEXTMEASUREREGISTRY_H
 #define HARMONY_TEXTMEASUREREGISTRY_H
 
+#include <array>
+#include <atomic>
+#include <list>
 #include <map>
+#include <optional>
+#include <folly/Hash.h>
 #include "RNOH/ArkUITypography.h"
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <arkui/styled_string.h>
 #include <mutex>
+#include <shared_mutex>
+
+/**
+ * Identifies the paragraph whose measured typography is kept in the
+ * registry. The hash is computed once, when the key is created.
+ */
+struct TextMeasureKey {
+  TextMeasureKey(int rnInstanceId, facebook::react::SurfaceId surfaceId, facebook::react::Tag tag)
+    : rnInstanceId(rnInstanceId),
+      surfaceId(surfaceId),
+      tag(tag),
+      hash(folly::hash::hash_combine(rnInstanceId, surfaceId, tag)) {}
+
+  bool operator==(const TextMeasureKey& rhs) const {
+    return tag == rhs.tag && surfaceId == rhs.surfaceId && rnInstanceId == rhs.rnInstanceId;
+  }
+
+  int rnInstanceId;
+  facebook::react::SurfaceId surfaceId;
+  facebook::react::Tag tag;
+  size_t hash;
+};
+
+struct TextMeasureKeyHash {
+  size_t operator()(const TextMeasureKey& key) const {
+    return key.hash;
+  }
+};
 
 struct TextMeasureInfo {
   TextMeasureInfo();
   TextMeasureInfo(rnoh::ArkUITypographyBuilder builder,
-    rnoh::ArkUITypography tmpTypography) : 
+    rnoh::ArkUITypography tmpTypography) :
     builder(std::move(builder)),
     typography(std::move(tmpTypography)) {}
   rnoh::ArkUITypographyBuilder builder;
+  // laid out once, for a single maximum width: the typography is rendered
+  // on MAIN after it's published to a TextComponentInstance
   rnoh::ArkUITypography typography;
+
+  /**
+   * Rough estimate of the native memory held by the styled string and the
+   * laid out typography.
+   */
+  size_t estimateByteSize() const;
 };
 
+/**
+ * @ThreadSafe
+ *
+ * Caches measured typographies so that `TextComponentInstance` can reuse the
+ * paragraph laid out during measuring. Measure results are kept per
+ * RNInstance in a sharded LRU cache bounded by the estimated native memory of
+ * the entries, so parallel layout doesn't serialize on a single lock.
+ */
 class TextMeasureRegistry {
 public:
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t bytes;
+    size_t entries;
+  };
+
+  static constexpr size_t DEFAULT_MEMORY_BUDGET_BYTES = 16 * 1024 * 1024;
+
   static TextMeasureRegistry& getTextMeasureRegistry();
-  void setTextMeasureInfo(const std::string& key, std::shared_ptr<TextMeasureInfo> textMeasureInfo, facebook::react::TextMeasureCacheKey& cacheKey);
-  ArkUI_StyledString* getTextStyledString(const std::string& key);
-  std::optional<std::shared_ptr<TextMeasureInfo>> getTextMeasureInfoByKey(const std::string& key);
-  void eraseTextMeasureInfo(const std::string& key);
+  void setTextMeasureInfo(const TextMeasureKey& key, std::shared_ptr<TextMeasureInfo> textMeasureInfo, facebook::react::TextMeasureCacheKey& cacheKey);
+  ArkUI_StyledString* getTextStyledString(const TextMeasureKey& key);
+  std::optional<std::shared_ptr<TextMeasureInfo>> getTextMeasureInfoByKey(const TextMeasureKey& key);
+  void eraseTextMeasureInfo(const TextMeasureKey& key);
   std::optional<std::shared_ptr<TextMeasureInfo>> getTextMeasureInfo(
-    const facebook::react::TextMeasureCacheKey& cacheKey, float scale);
+    int rnInstanceId, const facebook::react::TextMeasureCacheKey& cacheKey, float scale);
+
+  /**
+   * Remembers the typography laid out for an attributed string, paragraph
+   * attributes and maximum width, regardless of the other layout
+   * constraints. The registry doesn't keep it alive: the entry is dropped
+   * once no measure result uses it.
+   */
+  void setTextMeasureInfoByWidth(
+    int rnInstanceId, facebook::react::TextMeasureCacheKey widthKey, std::shared_ptr<TextMeasureInfo> measureInfo);
+
+  /**
+   * Returns the typography already laid out for the maximum width of
+   * `widthKey`, or nullptr.
+   */
+  std::shared_ptr<TextMeasureInfo> getTextMeasureInfoByWidth(
+    int rnInstanceId, const facebook::react::TextMeasureCacheKey& widthKey, float scale);
   void clear();
 
+  /**
+   * Drops the cached measure results of the RNInstance.
+   */
+  void clear(int rnInstanceId);
+
+  /**
+   * Limits the estimated native memory of the typographies cached for the
+   * RNInstance, evicting the least recently used entries over the new budget.
+   */
+  void setMemoryBudget(int rnInstanceId, size_t bytes);
+
+  Stats getStats(int rnInstanceId);
+
  private:
+  static constexpr size_t SHARDS_COUNT = 16;
+
+  struct CacheEntry {
+    facebook::react::TextMeasureCacheKey cacheKey;
+    std::shared_ptr<TextMeasureInfo> measureInfo;
+  };
+
+  struct CacheShard {
+    std::mutex mutex;
+    // most recently used first
+    std::list<CacheEntry> entries;
+    std::unordered_map<facebook::react::TextMeasureCacheKey, std::list<CacheEntry>::iterator> entryByCacheKey;
+  };
+
+  /**
+   * A measure info reused for several widths is stored under several cache
+   * keys, so its memory is charged once, while any entry holds it.
+   */
+  struct Charge {
+    uint32_t entriesCount;
+    size_t byteSize;
+  };
+
+  struct ChargeShard {
+    std::mutex mutex;
+    std::unordered_map<const TextMeasureInfo*, Charge> chargeByMeasureInfo;
+  };
+
+  struct WidthShard {
+    static constexpr size_t MIN_SWEEP_THRESHOLD = 64;
+
+    std::mutex mutex;
+    std::unordered_map<facebook::react::TextMeasureCacheKey, std::weak_ptr<TextMeasureInfo>> measureInfoByWidthKey;
+    size_t sweepThreshold = MIN_SWEEP_THRESHOLD;
+
+    void sweepExpired();
+  };
+
+  struct InstanceCache {
+    std::array<CacheShard, SHARDS_COUNT> shards;
+    std::array<WidthShard, SHARDS_COUNT> widthShards;
+    // a cache shard may be locked before a charge shard, never the other way
+    std::array<ChargeShard, SHARDS_COUNT> chargeShards;
+    std::atomic<size_t> bytes{0};
+    std::atomic<size_t> budgetBytes{DEFAULT_MEMORY_BUDGET_BYTES};
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> evictions{0};
+  };
 
-  std::unordered_map<std::string, facebook::react::TextMeasureCacheKey> m_keyToCacheKey; // saved which cacheKey using by key
+  struct KeyShard {
+    std::mutex mutex;
+    std::unordered_map<TextMeasureKey, std::shared_ptr<TextMeasureInfo>, TextMeasureKeyHash> measureInfoByKey; // saved which measureInfo using by key
+  };
 
-  std::unordered_map<std::string, std::shared_ptr<TextMeasureInfo>> m_keyToMeasureInfo; // saved which measureInfo using by key
+  std::shared_ptr<InstanceCache> getInstanceCache(int rnInstanceId);
+  void clearInstanceCache(InstanceCache& instanceCache);
+  // evicts least recently used entries, visiting the shards from
+  // `firstShardIndex`, until the instance cache fits into its budget; the
+  // most recent entry of the first shard is kept
+  void evictUntilFits(InstanceCache& instanceCache, size_t firstShardIndex);
+  static void retainMeasureInfo(InstanceCache& instanceCache, const TextMeasureInfo& measureInfo, size_t byteSize);
+  static void releaseMeasureInfo(InstanceCache& instanceCache, const TextMeasureInfo& measureInfo);
+  static size_t getCacheShardIndex(const facebook::react::TextMeasureCacheKey& cacheKey);
+  WidthShard& getWidthShard(InstanceCache& instanceCache, const facebook::react::TextMeasureCacheKey& widthKey);
+  KeyShard& getKeyShard(const TextMeasureKey& key);
 
-  mutable folly::EvictingCacheMap<facebook::react::TextMeasureCacheKey, std::shared_ptr<TextMeasureInfo>>
-    m_textMeasureInfoCache{facebook::react::kSimpleThreadSafeCacheSizeCap}; // cached all measure result
-  std::mutex m_mutex;
+  std::shared_mutex m_instanceCacheByIdMutex;
+  std::unordered_map<int, std::shared_ptr<InstanceCache>> m_instanceCacheById;
+  std::array<KeyShard, SHARDS_COUNT> m_keyShards;
 };
 
 
 
 
-#endif //HARMONY_TEXTMEASUREREGISTRY_H
\ No newline at end of file
+#endif //HARMONY_TEXTMEASUREREGISTRY_H
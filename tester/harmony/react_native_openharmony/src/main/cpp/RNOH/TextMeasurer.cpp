@@ -24,26 +24,38 @@ using AttributedString = facebook::react::AttributedString;
 using ParagraphAttributes = facebook::react::ParagraphAttributes;
 using LayoutConstraints = facebook::react::LayoutConstraints;
 
+TextMeasurer::~TextMeasurer() {
+  TextMeasureRegistry::getTextMeasureRegistry().clear(m_rnInstanceId);
+}
+
+void TextMeasurer::setTextMeasureCacheMemoryBudget(size_t bytes) {
+  TextMeasureRegistry::getTextMeasureRegistry().setMemoryBudget(m_rnInstanceId, bytes);
+}
+
+TextMeasureRegistry::Stats TextMeasurer::getTextMeasureCacheStats() {
+  return TextMeasureRegistry::getTextMeasureRegistry().getStats(m_rnInstanceId);
+}
+
 TextMeasurement TextMeasurer::measure(
     AttributedString attributedString,
     ParagraphAttributes paragraphAttributes,
     LayoutConstraints layoutConstraints) {
     dealTextCase(attributedString, paragraphAttributes);
+    auto& textMeasureRegistry = TextMeasureRegistry::getTextMeasureRegistry();
+    std::optional<TextMeasureKey> key;
+    if (!attributedString.getFragments().empty()) {
+      auto const& parentShadowView = attributedString.getFragments()[0].parentShadowView;
+      key.emplace(m_rnInstanceId, parentShadowView.surfaceId, parentShadowView.tag);
+    }
     // calc typograph
     facebook::react::TextMeasureCacheKey cacheKey{attributedString, paragraphAttributes, layoutConstraints};
-    std::optional<std::shared_ptr<TextMeasureInfo>> measureInfo = TextMeasureRegistry::getTextMeasureRegistry().getTextMeasureInfo(cacheKey, m_scale);
+    std::optional<std::shared_ptr<TextMeasureInfo>> measureInfo = textMeasureRegistry.getTextMeasureInfo(m_rnInstanceId, cacheKey, m_scale);
     if (measureInfo.has_value()) {
-      if (!attributedString.getFragments().empty()) {
-        std::string key = std::to_string(m_rnInstanceId) + "_" + 
-          std::to_string(attributedString.getFragments()[0].parentShadowView.tag) + "_" + 
-          std::to_string(attributedString.getFragments()[0].parentShadowView.surfaceId);
-        TextMeasureRegistry::getTextMeasureRegistry().setTextMeasureInfo(key, measureInfo.value(), cacheKey);
+      auto textMeasurement = getTextMeasurement(*measureInfo.value());
+      if (key.has_value()) {
+        textMeasureRegistry.setTextMeasureInfo(key.value(), measureInfo.value(), cacheKey);
       }
-        const auto& typography = measureInfo.value()->typography;
-        auto height = typography.getHeight();
-        auto longestLineWidth = typography.getLongestLineWidth();
-        auto attachments = typography.getAttachments();
-        return {{.width = longestLineWidth + 0.5, .height = height}, attachments};
+      return textMeasurement;
     }
     if (paragraphAttributes.adjustsFontSizeToFit) {
       int maxFontSize = 0;
@@ -56,29 +68,46 @@ TextMeasurement TextMeasurer::measure(
       auto height = typography.getHeight();
       auto longestLineWidth = typography.getLongestLineWidth();
       auto attachments = typography.getAttachments();
-      if (!attributedString.getFragments().empty()) {
-        std::string key = std::to_string(m_rnInstanceId) + "_" + 
-          std::to_string(attributedString.getFragments()[0].parentShadowView.tag) + "_" + 
-          std::to_string(attributedString.getFragments()[0].parentShadowView.surfaceId);
+      if (key.has_value()) {
         std::shared_ptr<TextMeasureInfo> textMeasureInfo = std::make_shared<TextMeasureInfo>(std::move(typographyBuilder), std::move(typography));
-        TextMeasureRegistry::getTextMeasureRegistry().setTextMeasureInfo(key, textMeasureInfo, cacheKey);
+        textMeasureRegistry.setTextMeasureInfo(key.value(), textMeasureInfo, cacheKey);
       }
       return {{.width = longestLineWidth + 0.5, .height = height}, attachments};
+    }
+    // the typography only depends on the maximum width of the layout
+    // constraints, so it's shared by constraints which differ in the other
+    // sizes. A typography for another width has to be built anew: the
+    // published one may be rendered on MAIN at any time
+    std::shared_ptr<TextMeasureInfo> textMeasureInfo = nullptr;
+    if (key.has_value()) {
+      facebook::react::LayoutConstraints widthConstraints{};
+      widthConstraints.maximumSize.width = layoutConstraints.maximumSize.width;
+      facebook::react::TextMeasureCacheKey widthKey{attributedString, paragraphAttributes, widthConstraints};
+      textMeasureInfo = textMeasureRegistry.getTextMeasureInfoByWidth(m_rnInstanceId, widthKey, m_scale);
+      if (textMeasureInfo == nullptr) {
+        auto typographyBuilder = measureTypography(attributedString, paragraphAttributes, layoutConstraints);
+        auto typography = typographyBuilder.build();
+        textMeasureInfo = std::make_shared<TextMeasureInfo>(std::move(typographyBuilder), std::move(typography));
+        textMeasureRegistry.setTextMeasureInfoByWidth(m_rnInstanceId, std::move(widthKey), textMeasureInfo);
+      }
     } else {
       auto typographyBuilder = measureTypography(attributedString, paragraphAttributes, layoutConstraints);
       auto typography = typographyBuilder.build();
-      auto height = typography.getHeight();
-      auto longestLineWidth = typography.getLongestLineWidth();
-      auto attachments = typography.getAttachments();
-      if (!attributedString.getFragments().empty()) {
-        std::string key = std::to_string(m_rnInstanceId) + "_" + 
-          std::to_string(attributedString.getFragments()[0].parentShadowView.tag) + "_" + 
-          std::to_string(attributedString.getFragments()[0].parentShadowView.surfaceId);
-        std::shared_ptr<TextMeasureInfo> textMeasureInfo = std::make_shared<TextMeasureInfo>(std::move(typographyBuilder), std::move(typography));
-        TextMeasureRegistry::getTextMeasureRegistry().setTextMeasureInfo(key, textMeasureInfo, cacheKey);
-      }
-      return {{.width = longestLineWidth + 0.5, .height = height}, attachments};
+      textMeasureInfo = std::make_shared<TextMeasureInfo>(std::move(typographyBuilder), std::move(typography));
+    }
+    auto textMeasurement = getTextMeasurement(*textMeasureInfo);
+    if (key.has_value()) {
+      textMeasureRegistry.setTextMeasureInfo(key.value(), textMeasureInfo, cacheKey);
     }
+    return textMeasurement;
+}
+
+TextMeasurement TextMeasurer::getTextMeasurement(TextMeasureInfo const& measureInfo) {
+    auto const& typography = measureInfo.typography;
+    auto height = typography.getHeight();
+    auto longestLineWidth = typography.getLongestLineWidth();
+    auto attachments = typography.getAttachments();
+    return {{.width = longestLineWidth + 0.5, .height = height}, attachments};
 }
 
 void TextMeasurer::dealTextCase(
@@ -32,6 +32,9 @@ class TextMeasurer : public facebook::react::TextLayoutManagerDelegate {
         m_taskExecutor(taskExecutor),
         m_featureFlagRegistry(featureFlagManager),
         m_rnInstanceId(id) {}
+
+  ~TextMeasurer();
+
   facebook::react::TextMeasurement measure(
       facebook::react::AttributedString attributedString,
       facebook::react::ParagraphAttributes paragraphAttributes,
@@ -59,6 +62,14 @@ class TextMeasurer : public facebook::react::TextLayoutManagerDelegate {
 
     float getScale(){ return m_scale; };
 
+  /**
+   * Limits the estimated native memory of typographies cached for this
+   * RNInstance.
+   */
+  void setTextMeasureCacheMemoryBudget(size_t bytes);
+
+  TextMeasureRegistry::Stats getTextMeasureCacheStats();
+
     void registerFont(
     std::weak_ptr<NativeResourceManager> weakResourceManager,
     const std::string name,
@@ -74,6 +85,9 @@ class TextMeasurer : public facebook::react::TextLayoutManagerDelegate {
     facebook::react::ParagraphAttributes& paragraphAttributes,
     facebook::react::LayoutConstraints& layoutConstraints);
   
+  facebook::react::TextMeasurement getTextMeasurement(
+    TextMeasureInfo const& measureInfo);
+
   std::string stringCapitalize(const std::string& strInput);
   void textCaseTransform(std::string& textContent, facebook::react::TextTransform type);
   bool existDefaultFont(std::string path);
@@ -19,10 +19,14 @@ class ThreadGuard final {
  public:
   void assertThread() const {
     RNOH_ASSERT_MSG(
-        m_threadId == std::this_thread::get_id(),
+        isCurrentThread(),
         "This method must be called on the same thread that created the object.");
   }
 
+  bool isCurrentThread() const {
+    return m_threadId == std::this_thread::get_id();
+  }
+
   ThreadGuard() = default;
   ~ThreadGuard() {
     assertThread();
@@ -12,8 +12,6 @@ auto rnoh::TouchTarget::computeChildPoint(
     TouchTarget::Shared const& child) const -> Point {
   auto childLayout = child->getLayoutMetrics();
   auto childTransform = child->getTransform();
-  float scrollOffsetY = dispatcher.getOffsetForNode(this->getTouchTargetTag());
-  Point scrolledPoint = {point.x, point.y - scrollOffsetY};
 
   // the center of the view (relative to its origin)
   Point center{
@@ -31,7 +29,7 @@ auto rnoh::TouchTarget::computeChildPoint(
 
   // transform the vector from the origin of the transformation
   auto transformedOffsetFromCenter =
-      (scrolledPoint + this->getCurrentOffset() - transformationOrigin) *
+      (computeContentPoint(point) - transformationOrigin) *
       inverseTransform.value();
 
   // add back the offset of the center relative to the origin of the view
@@ -40,6 +38,13 @@ auto rnoh::TouchTarget::computeChildPoint(
   return localPoint;
 }
 
+auto rnoh::TouchTarget::computeContentPoint(Point const& point) const
+    -> Point {
+  float scrollOffsetY = dispatcher.getOffsetForNode(this->getTouchTargetTag());
+  Point scrolledPoint = {point.x, point.y - scrollOffsetY};
+  return scrolledPoint + this->getCurrentOffset();
+}
+
 /*
  * Invert 4x4 matrix.
  * Adapted from Mesa's glu library implementation
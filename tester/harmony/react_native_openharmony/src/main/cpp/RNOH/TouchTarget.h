@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <react/renderer/components/view/TouchEventEmitter.h>
 #include <react/renderer/graphics/Point.h>
 #include <react/renderer/graphics/Transform.h>
@@ -22,6 +23,11 @@ class TouchTarget {
   virtual Point computeChildPoint(
       Point const& point,
       TouchTarget::Shared const& child) const;
+  /**
+   * Maps a point in this target's coordinates to the coordinates its
+   * children are laid out in, accounting for scrolling.
+   */
+  Point computeContentPoint(Point const& point) const;
   /**
    * Provides the current offset of a scrollable touch target.
    */
@@ -52,6 +58,15 @@ class TouchTarget {
   virtual facebook::react::SharedTouchEventEmitter getTouchEventEmitter()
       const = 0;
   virtual std::vector<Shared> getTouchTargetChildren() = 0;
+  /**
+   * Returns the children that may contain the point (in this target's
+   * coordinates), topmost first. Returns all children by default.
+   */
+  virtual std::vector<Shared> getTouchTargetChildrenAt(Point const& point) {
+    auto children = getTouchTargetChildren();
+    std::reverse(children.begin(), children.end());
+    return children;
+  }
   virtual facebook::react::LayoutMetrics getLayoutMetrics() const = 0;
   virtual facebook::react::Transform getTransform() const = 0;
   virtual TouchTarget::Shared getTouchTargetParent() const = 0;
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "TouchTargetChildrenIndex.h"
+#include <algorithm>
+#include <functional>
+
+namespace rnoh {
+
+// bounding boxes are computed by transforming the corners, while touch
+// points are mapped with the inverse transform, so the boxes are slightly
+// enlarged to not lose hits on the edges to rounding
+static constexpr facebook::react::Float BOUNDING_BOX_TOLERANCE = 0.01;
+
+void TouchTargetChildrenIndex::build(
+    std::vector<facebook::react::Rect> const& childBoundingBoxes) {
+  m_entries.clear();
+  m_entries.reserve(childBoundingBoxes.size());
+  for (size_t i = 0; i < childBoundingBoxes.size(); ++i) {
+    m_entries.push_back({childBoundingBoxes[i], i});
+  }
+  std::sort(
+      m_entries.begin(), m_entries.end(), [](auto const& lhs, auto const& rhs) {
+        return lhs.boundingBox.getMinY() < rhs.boundingBox.getMinY();
+      });
+  m_maxBottoms.clear();
+  m_maxBottoms.reserve(m_entries.size());
+  for (auto const& entry : m_entries) {
+    auto bottom = entry.boundingBox.getMaxY();
+    m_maxBottoms.push_back(
+        m_maxBottoms.empty() ? bottom : std::max(m_maxBottoms.back(), bottom));
+  }
+  m_isBuilt = true;
+}
+
+void TouchTargetChildrenIndex::findChildrenAt(
+    facebook::react::Point const& point,
+    std::vector<size_t>& childIndices) const {
+  childIndices.clear();
+  auto minY = point.y - BOUNDING_BOX_TOLERANCE;
+  auto maxY = point.y + BOUNDING_BOX_TOLERANCE;
+  // entries starting below the point can't contain it
+  auto end = std::upper_bound(
+      m_entries.begin(),
+      m_entries.end(),
+      maxY,
+      [](facebook::react::Float y, Entry const& entry) {
+        return y < entry.boundingBox.getMinY();
+      });
+  for (auto i = end - m_entries.begin(); i > 0; --i) {
+    if (m_maxBottoms[i - 1] < minY) {
+      // no remaining entry reaches down to the point
+      break;
+    }
+    auto const& boundingBox = m_entries[i - 1].boundingBox;
+    if (boundingBox.getMaxY() >= minY &&
+        boundingBox.getMinX() <= point.x + BOUNDING_BOX_TOLERANCE &&
+        boundingBox.getMaxX() >= point.x - BOUNDING_BOX_TOLERANCE) {
+      childIndices.push_back(m_entries[i - 1].childIndex);
+    }
+  }
+  std::sort(childIndices.begin(), childIndices.end(), std::greater<>());
+}
+
+} // namespace rnoh
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/graphics/Point.h>
+#include <react/renderer/graphics/Rect.h>
+
+namespace rnoh {
+
+/**
+ * @internal
+ * @thread: MAIN
+ *
+ * Spatial index answering which children of a touch target may contain a
+ * point. It's built from the children's bounding boxes, given in the
+ * parent's content coordinates and in drawing order. The boxes are sorted by
+ * their top edge and a running maximum of their bottom edges ends the scan,
+ * so a query only visits children whose vertical extent can contain the
+ * point instead of the whole child list.
+ */
+class TouchTargetChildrenIndex {
+ public:
+  void build(std::vector<facebook::react::Rect> const& childBoundingBoxes);
+
+  void invalidate() {
+    m_isBuilt = false;
+  }
+
+  bool isBuilt() const {
+    return m_isBuilt;
+  }
+
+  /**
+   * Writes into `childIndices` the indices of the children whose bounding
+   * box contains the point, topmost (last drawn) first.
+   */
+  void findChildrenAt(
+      facebook::react::Point const& point,
+      std::vector<size_t>& childIndices) const;
+
+ private:
+  struct Entry {
+    facebook::react::Rect boundingBox;
+    size_t childIndex;
+  };
+
+  // sorted by the top edge of the bounding box
+  std::vector<Entry> m_entries;
+  // the largest bottom edge among `m_entries[0..i]`
+  std::vector<facebook::react::Float> m_maxBottoms;
+  bool m_isBuilt = false;
+};
+
+} // namespace rnoh
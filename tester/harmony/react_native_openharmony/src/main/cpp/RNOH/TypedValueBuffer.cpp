@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "TypedValueBuffer.h"
+#include <cstring>
+
+namespace rnoh {
+
+TypedValueBuffer::Reader::Reader(TypedValueBuffer const& buffer)
+    : m_buffer(buffer) {}
+
+TypedValueBuffer::Type TypedValueBuffer::Reader::readType() {
+  return static_cast<Type>(m_buffer.m_bytes[m_offset++]);
+}
+
+size_t TypedValueBuffer::Reader::readSize() {
+  uint32_t size;
+  std::memcpy(&size, m_buffer.m_bytes.data() + m_offset, sizeof(size));
+  m_offset += sizeof(size);
+  return size;
+}
+
+double TypedValueBuffer::Reader::readNumber() {
+  double number;
+  std::memcpy(&number, m_buffer.m_bytes.data() + m_offset, sizeof(number));
+  m_offset += sizeof(number);
+  return number;
+}
+
+char const* TypedValueBuffer::Reader::readString(size_t& length) {
+  length = readSize();
+  auto data = reinterpret_cast<char const*>(m_buffer.m_bytes.data() + m_offset);
+  m_offset += length + 1;
+  return data;
+}
+
+std::shared_ptr<TypedValueBuffer::Bytes> const&
+TypedValueBuffer::Reader::readArrayBuffer() {
+  return m_buffer.m_arrayBuffers[readSize()];
+}
+
+void TypedValueBuffer::writeNull() {
+  writeType(Type::Null);
+}
+
+void TypedValueBuffer::writeBoolean(bool value) {
+  writeType(value ? Type::True : Type::False);
+}
+
+void TypedValueBuffer::writeNumber(double number) {
+  writeType(Type::Number);
+  auto offset = m_bytes.size();
+  m_bytes.resize(offset + sizeof(number));
+  std::memcpy(m_bytes.data() + offset, &number, sizeof(number));
+}
+
+void TypedValueBuffer::writeString(char const* data, size_t length) {
+  writeType(Type::String);
+  writeRawString(data, length);
+}
+
+char* TypedValueBuffer::writeStringInPlace(size_t length) {
+  writeType(Type::String);
+  writeSize(length);
+  auto offset = m_bytes.size();
+  m_bytes.resize(offset + length + 1);
+  return reinterpret_cast<char*>(m_bytes.data() + offset);
+}
+
+void TypedValueBuffer::writeArray(size_t length) {
+  writeType(Type::Array);
+  writeSize(length);
+}
+
+size_t TypedValueBuffer::beginObject() {
+  writeType(Type::Object);
+  auto offset = m_bytes.size();
+  // patched by endObject, since properties may be skipped while writing
+  writeSize(0);
+  return offset;
+}
+
+void TypedValueBuffer::writeKey(char const* data, size_t length) {
+  writeRawString(data, length);
+}
+
+void TypedValueBuffer::endObject(size_t objectOffset, size_t propertiesCount) {
+  auto size32 = static_cast<uint32_t>(propertiesCount);
+  std::memcpy(m_bytes.data() + objectOffset, &size32, sizeof(size32));
+}
+
+void TypedValueBuffer::writeArrayBuffer(uint8_t const* data, size_t size) {
+  writeType(Type::ArrayBuffer);
+  writeSize(m_arrayBuffers.size());
+  m_arrayBuffers.push_back(std::make_shared<Bytes>(data, data + size));
+}
+
+void TypedValueBuffer::writeCallback(size_t callbackIndex) {
+  writeType(Type::Callback);
+  writeSize(callbackIndex);
+}
+
+void TypedValueBuffer::writeType(Type type) {
+  m_bytes.push_back(static_cast<uint8_t>(type));
+}
+
+void TypedValueBuffer::writeSize(size_t size) {
+  auto size32 = static_cast<uint32_t>(size);
+  auto offset = m_bytes.size();
+  m_bytes.resize(offset + sizeof(size32));
+  std::memcpy(m_bytes.data() + offset, &size32, sizeof(size32));
+}
+
+void TypedValueBuffer::writeRawString(char const* data, size_t length) {
+  writeSize(length);
+  m_bytes.insert(
+      m_bytes.end(),
+      reinterpret_cast<uint8_t const*>(data),
+      reinterpret_cast<uint8_t const*>(data) + length);
+  m_bytes.push_back('\0');
+}
+
+} // namespace rnoh
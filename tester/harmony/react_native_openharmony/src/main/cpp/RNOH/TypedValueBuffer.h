@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * @internal
+ * The storage of JSValueBuffer: a sequence of JSON-like values, written
+ * depth first into a flat byte buffer, each prefixed by its type. Arrays and
+ * objects store their number of elements, objects store a key before every
+ * property value. The contents of ArrayBuffers are kept aside, so that they
+ * can be shared with the JS engines without copying them. Only depends on
+ * the standard library, so that it can be tested on a host.
+ */
+class TypedValueBuffer {
+ public:
+  enum class Type : uint8_t {
+    Null,
+    False,
+    True,
+    Number,
+    String,
+    Array,
+    Object,
+    ArrayBuffer,
+    Callback,
+  };
+
+  using Bytes = std::vector<uint8_t>;
+
+  /**
+   * Reads the values in the order they were written. The buffer must
+   * outlive the reader and must not be written in the meantime.
+   */
+  class Reader {
+   public:
+    explicit Reader(TypedValueBuffer const& buffer);
+
+    Type readType();
+    /**
+     * Reads the length of an array, the number of properties of an object,
+     * or the index of an ArrayBuffer or a callback.
+     */
+    size_t readSize();
+    double readNumber();
+    /**
+     * Strings are stored with a terminating NUL, which isn't included in
+     * `length`.
+     */
+    char const* readString(size_t& length);
+    std::shared_ptr<Bytes> const& readArrayBuffer();
+
+   private:
+    TypedValueBuffer const& m_buffer;
+    size_t m_offset = 0;
+  };
+
+  void writeNull();
+  void writeBoolean(bool value);
+  void writeNumber(double number);
+  void writeString(char const* data, size_t length);
+  /**
+   * Writes a string of `length` bytes, which the caller copies to the
+   * returned address, followed by a NUL. The address is valid until the
+   * next write.
+   */
+  char* writeStringInPlace(size_t length);
+  /**
+   * Must be followed by `length` values.
+   */
+  void writeArray(size_t length);
+  /**
+   * Must be followed by the properties, each written as a key followed by a
+   * value, and then by `endObject` with the returned offset.
+   */
+  size_t beginObject();
+  void writeKey(char const* data, size_t length);
+  void endObject(size_t objectOffset, size_t propertiesCount);
+  /**
+   * Copies the contents of the ArrayBuffer once.
+   */
+  void writeArrayBuffer(uint8_t const* data, size_t size);
+  void writeCallback(size_t callbackIndex);
+
+ private:
+  void writeType(Type type);
+  void writeSize(size_t size);
+  void writeRawString(char const* data, size_t length);
+
+  Bytes m_bytes;
+  std::vector<std::shared_ptr<Bytes>> m_arrayBuffers;
+};
+
+} // namespace rnoh
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <glog/logging.h>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
@@ -33,6 +34,15 @@ class UITicker {
 
   using Shared = std::shared_ptr<UITicker>;
 
+  /**
+   * Period of the display the ticker is synchronized with, refreshed on
+   * every tick. Until the first tick, or if the platform can't provide it,
+   * the period of a 120 Hz display is assumed.
+   */
+  std::chrono::nanoseconds getVsyncPeriod() const {
+    return std::chrono::nanoseconds(m_vsyncPeriodNs.load());
+  }
+
   std::function<void()> subscribe(std::function<void(Timestamp)>&& listener) {
     std::lock_guard lock(listenersMutex);
     auto id = m_nextListenerId;
@@ -52,13 +62,21 @@ class UITicker {
   std::unordered_map<int, std::function<void(Timestamp)>> m_listenerById;
   std::mutex listenersMutex;
   NativeVsyncHandle m_vsyncHandle;
+  std::atomic<long long> m_vsyncPeriodNs{DEFAULT_VSYNC_PERIOD_NS};
   int m_nextListenerId = 0;
 
+  static constexpr long long DEFAULT_VSYNC_PERIOD_NS = 1000000000 / 120;
+
   void requestNextTick() {
     m_vsyncHandle.requestFrame(onTick, this);
   }
 
   void tick(Timestamp timestamp) {
+    long long vsyncPeriodNs = 0;
+    if (m_vsyncHandle.getVsyncPeriod(&vsyncPeriodNs) == 0 &&
+        vsyncPeriodNs > 0) {
+      m_vsyncPeriodNs = vsyncPeriodNs;
+    }
     std::lock_guard lock(listenersMutex);
     if (m_listenerById.empty()) {
       return;
@@ -23,22 +23,76 @@ using facebook::react::Scheduler;
 using facebook::react::SurfaceHandler;
 using facebook::react::SurfaceId;
 
-class SurfaceTouchEventHandler : public UIInputEventHandler,
-                                 public ArkTSMessageHub::Observer {
+class SurfaceTouchEventHandler
+    : public UIInputEventHandler,
+      public ArkTSMessageHub::Observer,
+      public std::enable_shared_from_this<SurfaceTouchEventHandler> {
  private:
   ComponentInstance::Shared m_rootView;
   TouchEventDispatcher m_touchEventDispatcher;
   int m_rnInstanceId;
+  UITicker::Shared m_uiTicker;
+  TaskExecutor::Weak m_weakTaskExecutor;
+  std::function<void()> m_unsubscribeUITickerListener = nullptr;
+
+  /**
+   * Touch panels may report moves several times per frame. They are sent to
+   * JS once per frame, when the next vsync arrives.
+   */
+  void onMoveEventsPending() {
+    if (m_unsubscribeUITickerListener != nullptr || m_uiTicker == nullptr) {
+      return;
+    }
+    m_unsubscribeUITickerListener = m_uiTicker->subscribe(
+        [weakSelf = weak_from_this(),
+         weakTaskExecutor = m_weakTaskExecutor](auto /*recentVSyncTimestamp*/) {
+          auto taskExecutor = weakTaskExecutor.lock();
+          if (taskExecutor == nullptr) {
+            return;
+          }
+          taskExecutor->runTask(TaskThread::MAIN, [weakSelf] {
+            if (auto self = weakSelf.lock()) {
+              self->onUITick();
+            }
+          });
+        });
+  }
+
+  void onUITick() {
+    facebook::react::SystraceSection s("SurfaceTouchEventHandler::onUITick");
+    if (m_touchEventDispatcher.hasPendingMoveEvents()) {
+      m_touchEventDispatcher.flushPendingMoveEvents();
+      return;
+    }
+    // no touch moved during the last frame; stop listening until one does
+    unsubscribeFromUITicker();
+  }
+
+  void unsubscribeFromUITicker() {
+    if (m_unsubscribeUITickerListener != nullptr) {
+      m_unsubscribeUITickerListener();
+      m_unsubscribeUITickerListener = nullptr;
+    }
+  }
 
  public:
   SurfaceTouchEventHandler(
       ComponentInstance::Shared rootView,
       ArkTSMessageHub::Shared arkTSMessageHub,
-      int rnInstanceId)
+      int rnInstanceId,
+      UITicker::Shared uiTicker,
+      TaskExecutor::Weak weakTaskExecutor)
       : UIInputEventHandler(rootView->getLocalRootArkUINode()),
         ArkTSMessageHub::Observer(arkTSMessageHub),
         m_rootView(std::move(rootView)),
-        m_rnInstanceId(rnInstanceId) {}
+        m_rnInstanceId(rnInstanceId),
+        m_uiTicker(std::move(uiTicker)),
+        m_weakTaskExecutor(std::move(weakTaskExecutor)) {
+    if (m_uiTicker != nullptr) {
+      m_touchEventDispatcher.setOnMoveEventsPending(
+          [this] { onMoveEventsPending(); });
+    }
+  }
   SurfaceTouchEventHandler(SurfaceTouchEventHandler const& other) = delete;
   SurfaceTouchEventHandler& operator=(SurfaceTouchEventHandler const& other) =
       delete;
@@ -47,7 +101,9 @@ class SurfaceTouchEventHandler : public UIInputEventHandler,
   SurfaceTouchEventHandler& operator=(
       SurfaceTouchEventHandler&& other) noexcept = delete;
 
-  ~SurfaceTouchEventHandler() override = default;
+  ~SurfaceTouchEventHandler() override {
+    unsubscribeFromUITicker();
+  }
 
   void onTouchEvent(ArkUI_UIInputEvent* event) override {
     m_touchEventDispatcher.dispatchTouchEvent(event, m_rootView);
@@ -68,6 +124,7 @@ ArkUISurface::ArkUISurface(
     ComponentInstanceRegistry::Shared componentInstanceRegistry,
     ComponentInstanceFactory::Shared const& componentInstanceFactory,
     ArkTSMessageHub::Shared arkTSMessageHub,
+    UITicker::Shared uiTicker,
     SurfaceId surfaceId,
     int rnInstanceId,
     std::string const& appKey)
@@ -87,7 +144,11 @@ ArkUISurface::ArkUISurface(
   m_componentInstanceRegistry->insert(m_rootView);
   RNOH_ASSERT(arkTSMessageHub != nullptr);
   m_touchEventHandler = std::make_shared<SurfaceTouchEventHandler>(
-      m_rootView, std::move(arkTSMessageHub), rnInstanceId);
+      m_rootView,
+      std::move(arkTSMessageHub),
+      rnInstanceId,
+      std::move(uiTicker),
+      taskExecutor);
 }
 
 ArkUISurface::ArkUISurface(ArkUISurface&& other) noexcept
@@ -14,6 +14,7 @@
 #include "RNOH/ComponentInstanceFactory.h"
 #include "RNOH/ComponentInstanceRegistry.h"
 #include "RNOH/ThreadGuard.h"
+#include "RNOH/UITicker.h"
 #include "RNOH/arkui/NodeContentHandle.h"
 #include "RNOH/arkui/UIInputEventHandler.h"
 
@@ -36,6 +37,7 @@ class ArkUISurface
       ComponentInstanceRegistry::Shared componentInstanceRegistry,
       ComponentInstanceFactory::Shared const& componentInstanceFactory,
       ArkTSMessageHub::Shared arkTSMessageHub,
+      UITicker::Shared uiTicker,
       facebook::react::SurfaceId surfaceId,
       int rnInstanceId,
       std::string const& appKey);
@@ -7,6 +7,7 @@
 
 #include "TouchEventDispatcher.h"
 #include <glog/logging.h>
+#include <algorithm>
 #include <set>
 #include "RNOH/Assert.h"
 
@@ -26,10 +27,8 @@ static std::pair<TouchTarget::Shared, Point> findTargetForTouchPoint(
       target->containsPointInBoundingBox(point);
 
   if (canChildrenHandleTouch) {
-    auto children = target->getTouchTargetChildren();
-    // we want to check the children in reverse order, since the last child is
-    // the topmost one
-    std::reverse(children.begin(), children.end());
+    // the topmost child comes first
+    auto children = target->getTouchTargetChildrenAt(point);
     for (auto const& child : children) {
       if (child == nullptr) {
         RNOH_ASSERT(child != nullptr);
@@ -150,6 +149,10 @@ void TouchEventDispatcher::findTargetAndSendTouchEvent(
   // we cast it to a double and convert it to seconds.
   double timestampSeconds = static_cast<double>(touchEvent.timestamp) / 1e9;
 
+  if (touchEvent.action != UI_TOUCH_EVENT_ACTION_MOVE) {
+    flushPendingMoveEvents();
+  }
+
   facebook::react::Touches touches(m_previousEvent.touches);
   facebook::react::Touches changedTouches;
   facebook::react::Touches cancelTouches;
@@ -176,6 +179,7 @@ void TouchEventDispatcher::findTargetAndSendTouchEvent(
         continue;
       }
       if (isAncestorHandlingTouches(touchTarget, rootTarget)) {
+        flushPendingMoveEvents();
         cancelPreviousTouchEvent(timestampSeconds, touchTarget);
         m_touchTargetByTouchId.erase(activeTouch.id);
         continue;
@@ -232,6 +236,10 @@ void TouchEventDispatcher::findTargetAndSendTouchEvent(
   }
 
   if (touchEvent.action == UI_TOUCH_EVENT_ACTION_MOVE) {
+    if (m_onMoveEventsPending != nullptr) {
+      stageMoveTouches(changedTouches);
+      return;
+    }
     touches = changedTouches;
   } else {
     const auto& touch = *(changedTouches.begin());
@@ -325,7 +333,8 @@ void TouchEventDispatcher::cancelPreviousTouchEvent(
 void TouchEventDispatcher::sendEvent(
     facebook::react::Touches const& touches,
     facebook::react::Touches const& changedTouches,
-    int32_t action) {
+    int32_t action,
+    std::vector<facebook::react::Touch> historicalTouches) {
   std::unordered_map<TouchTarget::Shared, facebook::react::Touches>
       touchesByTarget;
 
@@ -374,7 +383,8 @@ void TouchEventDispatcher::sendEvent(
     facebook::react::TouchEvent touchEvent{
         .touches = touches,
         .changedTouches = changedTouches,
-        .targetTouches = targetTouches};
+        .targetTouches = targetTouches,
+        .historicalTouches = historicalTouches};
 
     if (action == UI_TOUCH_EVENT_ACTION_MOVE &&
         canIgnoreMoveEvent(touchEvent)) {
@@ -405,9 +415,75 @@ void TouchEventDispatcher::sendEvent(
 }
 
 void TouchEventDispatcher::cancelActiveTouches() {
+  flushPendingMoveEvents();
   if (m_previousEvent.touches.size() > 0) {
     sendEvent({}, m_previousEvent.touches, UI_TOUCH_EVENT_ACTION_CANCEL);
   }
 }
 
+void TouchEventDispatcher::setOnMoveEventsPending(
+    std::function<void()> onMoveEventsPending) {
+  m_onMoveEventsPending = std::move(onMoveEventsPending);
+}
+
+void TouchEventDispatcher::stageMoveTouches(
+    facebook::react::Touches const& changedTouches) {
+  bool hadPendingMoveEvents = hasPendingMoveEvents();
+  for (auto const& touch : changedTouches) {
+    auto pendingTouchIt = m_pendingMoveTouches.find(touch);
+    if (pendingTouchIt != m_pendingMoveTouches.end()) {
+      auto& historicalTouches =
+          m_pendingHistoricalTouchesByTouchId[touch.identifier];
+      historicalTouches.push_back(*pendingTouchIt);
+      if (historicalTouches.size() > MAX_HISTORICAL_TOUCHES_COUNT) {
+        historicalTouches.pop_front();
+      }
+      m_pendingMoveTouches.erase(pendingTouchIt);
+    }
+    m_pendingMoveTouches.insert(touch);
+  }
+  if (!hadPendingMoveEvents) {
+    m_onMoveEventsPending();
+  }
+}
+
+void TouchEventDispatcher::flushPendingMoveEvents() {
+  if (!hasPendingMoveEvents()) {
+    return;
+  }
+  // touches that ended in the meantime are no longer reported as moved
+  facebook::react::Touches touches;
+  std::vector<facebook::react::Touch> historicalTouches;
+  for (auto const& touch : m_pendingMoveTouches) {
+    if (m_touchTargetByTouchId.count(touch.identifier) == 0) {
+      continue;
+    }
+    touches.insert(touch);
+    auto historicalTouchesIt =
+        m_pendingHistoricalTouchesByTouchId.find(touch.identifier);
+    if (historicalTouchesIt != m_pendingHistoricalTouchesByTouchId.end()) {
+      historicalTouches.insert(
+          historicalTouches.end(),
+          historicalTouchesIt->second.begin(),
+          historicalTouchesIt->second.end());
+    }
+  }
+  m_pendingMoveTouches.clear();
+  m_pendingHistoricalTouchesByTouchId.clear();
+  // samples of different touches are interleaved in the order they were taken
+  std::stable_sort(
+      historicalTouches.begin(),
+      historicalTouches.end(),
+      [](auto const& lhs, auto const& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+      });
+  if (!touches.empty()) {
+    sendEvent(
+        touches,
+        touches,
+        UI_TOUCH_EVENT_ACTION_MOVE,
+        std::move(historicalTouches));
+  }
+}
+
 } // namespace rnoh
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <arkui/ui_input_event.h>
+#include <deque>
+#include <functional>
 #include <unordered_map>
 #include "RNOH/TouchTarget.h"
 #include "TouchEvent.h"
@@ -29,6 +31,12 @@ struct ScrollInfo {
 class TouchEventDispatcher {
  public:
   using TouchId = int;
+
+  /**
+   * Maximum number of coalesced samples remembered per touch.
+   */
+  static constexpr size_t MAX_HISTORICAL_TOUCHES_COUNT = 32;
+
   void updateOffset(int32_t nodeId, float offset);
 
   float getOffsetForNode(int32_t nodeId) const;
@@ -67,6 +75,29 @@ class TouchEventDispatcher {
    */
   void cancelActiveTouches();
 
+  /**
+   * @internal
+   * Enables coalescing of MOVE events. Instead of being sent immediately,
+   * MOVE events are merged per touch and `onMoveEventsPending` is called.
+   * The owner is expected to call `flushPendingMoveEvents` on the MAIN thread
+   * when the next frame begins, so that JS receives at most one MOVE event
+   * per frame. Without the callback, MOVE events are sent immediately.
+   */
+  void setOnMoveEventsPending(std::function<void()> onMoveEventsPending);
+
+  /**
+   * @internal
+   * Sends the MOVE event combining the most recent samples of the moved
+   * touches. The older samples that were coalesced into it are sent as the
+   * `historicalTouches` of the event, oldest first. DOWN, UP and CANCEL
+   * events flush pending MOVE events first.
+   */
+  void flushPendingMoveEvents();
+
+  bool hasPendingMoveEvents() const {
+    return !m_pendingMoveTouches.empty();
+  }
+
  private:
   void findTargetAndSendTouchEvent(
       TouchTarget::Shared const& rootTarget,
@@ -82,9 +113,15 @@ class TouchEventDispatcher {
   void sendEvent(
       facebook::react::Touches const& touches,
       facebook::react::Touches const& changedTouches,
-      int32_t action);
+      int32_t action,
+      std::vector<facebook::react::Touch> historicalTouches = {});
+  void stageMoveTouches(facebook::react::Touches const& changedTouches);
 
   std::unordered_map<TouchId, TouchTarget::Shared> m_touchTargetByTouchId;
+  std::function<void()> m_onMoveEventsPending;
+  facebook::react::Touches m_pendingMoveTouches;
+  std::unordered_map<TouchId, std::deque<facebook::react::Touch>>
+      m_pendingHistoricalTouchesByTouchId;
   facebook::react::TouchEvent m_previousEvent;
 };
 
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "FFRTParallelExecutor.h"
+#include <ffrt/cpp/pattern/job_partner.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include "RNOH/FFRTConfig.h"
+
+namespace rnoh {
+
+namespace {
+// warms up FFRT workers when the library is loaded, so that the first loop
+// doesn't wait for them
+auto prehot = ffrt::submit_h(
+    [] {},
+    {},
+    {},
+    ffrt::task_attr().name("prehot").qos(ffrt::qos_user_initiated));
+} // namespace
+
+FFRTParallelExecutor::FFRTParallelExecutor(size_t workersCount)
+    : ParallelExecutor(workersCount) {
+  for (size_t i = 0; i < workersCount; i++) {
+    m_workerStacks.push_back(std::make_unique<char[]>(WORKER_STACK_SIZE));
+  }
+}
+
+void FFRTParallelExecutor::run(
+    size_t chunksCount,
+    std::function<void(size_t)> const& runChunkAt) {
+  std::unique_lock<std::mutex> lock(m_mtx, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    // another thread runs a loop on the worker stacks
+    for (size_t i = 0; i < chunksCount; i++) {
+      runChunkAt(i);
+    }
+    return;
+  }
+  auto jobPartner = ffrt::job_partner<ScenarioID::SHADOW_TREE_PARALLELIZATION>::
+      get_partner_of_this_thread(
+          ffrt::job_partner_attr()
+              .max_parallelism(getWorkersCount())
+              .qos(THREAD_PRIORITY_LEVEL_5));
+
+  std::atomic<size_t> nextChunkIndex{0};
+  std::mutex exceptionMtx;
+  std::exception_ptr exception;
+  auto runChunks = [&] {
+    WorkerThreadScope workerThreadScope;
+    while (true) {
+      auto chunkIndex = nextChunkIndex.fetch_add(1, std::memory_order_relaxed);
+      if (chunkIndex >= chunksCount) {
+        return;
+      }
+      try {
+        runChunkAt(chunkIndex);
+      } catch (...) {
+        std::lock_guard<std::mutex> exceptionLock(exceptionMtx);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+    }
+  };
+  auto workerJobsCount = std::min(m_workerStacks.size(), chunksCount);
+  for (size_t i = 0; i < workerJobsCount; i++) {
+    jobPartner->submit(
+        std::function<void()>(runChunks),
+        m_workerStacks[i].get(),
+        WORKER_STACK_SIZE);
+  }
+  // job_partner runs tasks submitted to the calling thread only while it
+  // waits, so the calling thread doesn't claim chunks itself: workers would
+  // be stuck on it until it ran out of chunks
+  jobPartner->wait();
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void FFRTParallelExecutor::executeOnCallerThread(Task task) {
+  ffrt::job_partner<>::submit_to_master(std::move(task));
+}
+
+} // namespace rnoh
@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+#include "ParallelExecutor.h"
+
+namespace rnoh {
+
+/**
+ * @ThreadSafe
+ *
+ * A ParallelExecutor backed by an FFRT job_partner. Worker jobs claim chunks
+ * from a shared counter until none are left, so only one job, and one stack,
+ * is needed per worker. The calling thread runs JSI work for the workers.
+ */
+class FFRTParallelExecutor : public ParallelExecutor {
+ public:
+  explicit FFRTParallelExecutor(size_t workersCount);
+
+ protected:
+  void run(size_t chunksCount, std::function<void(size_t)> const& runChunkAt)
+      override;
+
+  void executeOnCallerThread(Task task) override;
+
+ private:
+  // worker jobs are suspended while they wait for the calling thread, so each
+  // of them runs on its own stack
+  static constexpr size_t WORKER_STACK_SIZE = 32 * 1024;
+
+  std::mutex m_mtx;
+  std::vector<std::unique_ptr<char[]>> m_workerStacks;
+};
+
+} // namespace rnoh
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "ParallelExecutor.h"
+#include <algorithm>
+#include <atomic>
+#include "RNOH/FFRTConfig.h"
+#ifdef PARALLELIZATION_ON
+#include "FFRTParallelExecutor.h"
+#else
+#include "ThreadPoolParallelExecutor.h"
+#endif
+
+namespace rnoh {
+
+namespace {
+// Until this many samples were collected the running mean is used;
+// afterwards samples are folded in with an EWMA.
+constexpr uint32_t MIN_SAMPLES_FOR_ESTIMATE = 4;
+// EWMA weight of a new sample is 1 / EWMA_WEIGHT_DIVISOR.
+constexpr int64_t EWMA_WEIGHT_DIVISOR = 8;
+// A single sample is clamped so that a one-off stall (GC, page fault) can't
+// make iterations look expensive for a long time.
+constexpr int64_t MAX_ITERATION_SAMPLE_NS = 1'000'000;
+
+// Waking up workers costs tens of microseconds, so loops estimated to be
+// shorter than this run on the calling thread only.
+constexpr int64_t MIN_PARALLEL_LOOP_DURATION_NS = 500'000;
+// Chunks should be long enough to amortize claiming them...
+constexpr int64_t TARGET_CHUNK_DURATION_NS = 250'000;
+// ...while every thread gets a few of them, so that threads which finish
+// early can take over the work of slower ones.
+constexpr size_t MIN_CHUNKS_PER_THREAD = 4;
+
+std::mutex instanceMtx;
+std::unique_ptr<ParallelExecutor> instance;
+std::atomic<ParallelExecutor*> instancePtr{nullptr};
+} // namespace
+
+thread_local bool ParallelExecutor::isRunningOnWorker = false;
+
+ParallelExecutor::IterationCost::IterationCost(
+    std::chrono::nanoseconds initialEstimate)
+    : m_averageNs(initialEstimate.count()) {}
+
+void ParallelExecutor::IterationCost::recordSample(
+    size_t iterationsCount,
+    std::chrono::nanoseconds duration) {
+  if (iterationsCount == 0) {
+    return;
+  }
+  auto sampleNs = std::clamp<int64_t>(
+      duration.count() / static_cast<int64_t>(iterationsCount),
+      0,
+      MAX_ITERATION_SAMPLE_NS);
+  std::lock_guard<std::mutex> lock(m_mtx);
+  if (m_sampleCount < MIN_SAMPLES_FOR_ESTIMATE) {
+    // the initial estimate isn't a sample
+    m_averageNs = m_sampleCount == 0
+        ? sampleNs
+        : (m_averageNs * m_sampleCount + sampleNs) / (m_sampleCount + 1);
+    m_sampleCount++;
+    return;
+  }
+  m_averageNs += (sampleNs - m_averageNs) / EWMA_WEIGHT_DIVISOR;
+}
+
+std::chrono::nanoseconds ParallelExecutor::IterationCost::estimate() const {
+  std::lock_guard<std::mutex> lock(m_mtx);
+  return std::chrono::nanoseconds(m_averageNs);
+}
+
+ParallelExecutor& ParallelExecutor::getInstance() {
+  if (auto executor = instancePtr.load(std::memory_order_acquire)) {
+    return *executor;
+  }
+  std::lock_guard<std::mutex> lock(instanceMtx);
+  if (instance == nullptr) {
+#ifdef PARALLELIZATION_ON
+    instance = std::make_unique<FFRTParallelExecutor>(
+        MAX_THREAD_NUM_SHADOW_TREE);
+#else
+    instance = std::make_unique<ThreadPoolParallelExecutor>(
+        MAX_THREAD_NUM_SHADOW_TREE);
+#endif
+    instancePtr.store(instance.get(), std::memory_order_release);
+  }
+  return *instance;
+}
+
+void ParallelExecutor::setInstance(std::unique_ptr<ParallelExecutor> executor) {
+  std::lock_guard<std::mutex> lock(instanceMtx);
+  instancePtr.store(executor.get(), std::memory_order_release);
+  instance = std::move(executor);
+}
+
+ParallelExecutor::ParallelExecutor(size_t workersCount)
+    : m_workersCount(workersCount) {}
+
+void ParallelExecutor::parallelFor(
+    size_t iterationsCount,
+    IterationCost& cost,
+    std::function<void(size_t)> const& body) {
+  if (iterationsCount == 0) {
+    return;
+  }
+  auto iterationNs = std::max<int64_t>(cost.estimate().count(), 1);
+  auto threadsCount = m_workersCount + 1;
+  size_t chunkSize = iterationsCount;
+  if (m_workersCount > 0 &&
+      iterationNs * static_cast<int64_t>(iterationsCount) >=
+          MIN_PARALLEL_LOOP_DURATION_NS) {
+    auto maxChunkSize = std::max<size_t>(
+        iterationsCount / (threadsCount * MIN_CHUNKS_PER_THREAD), 1);
+    chunkSize = std::clamp<size_t>(
+        TARGET_CHUNK_DURATION_NS / iterationNs, 1, maxChunkSize);
+  }
+  auto chunksCount = (iterationsCount + chunkSize - 1) / chunkSize;
+  auto runChunk = [&](size_t chunkIndex) {
+    auto begin = chunkIndex * chunkSize;
+    auto end = std::min(begin + chunkSize, iterationsCount);
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto i = begin; i < end; i++) {
+      body(i);
+    }
+    cost.recordSample(end - begin, std::chrono::steady_clock::now() - startTime);
+  };
+  if (chunksCount == 1) {
+    runChunk(0);
+    return;
+  }
+  run(chunksCount, runChunk);
+}
+
+} // namespace rnoh
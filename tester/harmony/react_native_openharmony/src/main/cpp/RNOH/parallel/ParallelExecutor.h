@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rnoh {
+
+/**
+ * @ThreadSafe
+ *
+ * Runs the iterations of a loop on worker threads, and on the calling thread
+ * when the backend allows it.
+ * JSI may only be used on the thread that started the loop, so iterations
+ * running on workers use `runOnCallerThread` for that.
+ *
+ * Loops are split into chunks based on the measured cost of an iteration,
+ * so that cheap loops run on the calling thread only and expensive ones are
+ * split finely enough for idle threads to pick up the remaining work.
+ *
+ * This library only depends on the standard library (and FFRT for the FFRT
+ * backend), so that parallel tree creation can be benchmarked and tested
+ * outside of OpenHarmony.
+ */
+class ParallelExecutor {
+ public:
+  using Task = std::function<void()>;
+
+  /**
+   * The learned cost of a single iteration of one kind of loop, e.g. creating
+   * a shadow node. Samples are recorded for every chunk that ran.
+   */
+  class IterationCost {
+   public:
+    explicit IterationCost(std::chrono::nanoseconds initialEstimate);
+
+    void recordSample(size_t iterationsCount, std::chrono::nanoseconds duration);
+
+    std::chrono::nanoseconds estimate() const;
+
+   private:
+    mutable std::mutex m_mtx;
+    int64_t m_averageNs;
+    uint32_t m_sampleCount = 0;
+  };
+
+  /**
+   * The executor used by React's shadow tree creation. Backed by FFRT when
+   * built with PARALLELIZATION_ON, by a std::thread pool otherwise.
+   */
+  static ParallelExecutor& getInstance();
+
+  /**
+   * Replaces the executor returned by `getInstance`. Must not be called while
+   * a loop runs. Meant for benchmarks and tests comparing backends.
+   */
+  static void setInstance(std::unique_ptr<ParallelExecutor> executor);
+
+  /**
+   * Whether the current thread runs iterations of a loop started by another
+   * thread.
+   */
+  static bool isWorkerThread() {
+    return isRunningOnWorker;
+  }
+
+  /**
+   * On a worker running an iteration of a loop, runs `task` on the thread
+   * that started the loop and waits for it to finish. On any other thread,
+   * runs `task` immediately, without looking up the executor or wrapping
+   * `task` in a std::function.
+   */
+  template <typename F>
+  static void runOnCallerThread(F&& task) {
+    if (!isWorkerThread()) {
+      task();
+      return;
+    }
+    getInstance().executeOnCallerThread(Task(std::forward<F>(task)));
+  }
+
+  virtual ~ParallelExecutor() = default;
+
+  /**
+   * Calls `body(index)` for every index in [0, iterationsCount) and returns
+   * once all of them finished. Must not be called from within a loop.
+   */
+  void parallelFor(
+      size_t iterationsCount,
+      IterationCost& cost,
+      std::function<void(size_t)> const& body);
+
+  /**
+   * Number of worker threads helping the calling thread.
+   */
+  size_t getWorkersCount() const {
+    return m_workersCount;
+  }
+
+ protected:
+  explicit ParallelExecutor(size_t workersCount);
+
+  /**
+   * Calls `runChunkAt(chunkIndex)` for every chunk index in [0, chunksCount)
+   * on the workers and, depending on the backend, the calling thread. While
+   * waiting for workers, the calling thread must run tasks passed to
+   * `executeOnCallerThread`.
+   */
+  virtual void run(
+      size_t chunksCount,
+      std::function<void(size_t)> const& runChunkAt) = 0;
+
+  /**
+   * Implements `runOnCallerThread` for loops run by this executor. Only
+   * called on worker threads.
+   */
+  virtual void executeOnCallerThread(Task task) = 0;
+
+  /**
+   * Marks the current thread as a worker while a backend runs chunks on it.
+   */
+  class WorkerThreadScope {
+   public:
+    WorkerThreadScope() : m_wasRunningOnWorker(isRunningOnWorker) {
+      isRunningOnWorker = true;
+    }
+    ~WorkerThreadScope() {
+      isRunningOnWorker = m_wasRunningOnWorker;
+    }
+    WorkerThreadScope(WorkerThreadScope const&) = delete;
+    WorkerThreadScope& operator=(WorkerThreadScope const&) = delete;
+
+   private:
+    bool m_wasRunningOnWorker;
+  };
+
+ private:
+  static thread_local bool isRunningOnWorker;
+
+  size_t m_workersCount;
+};
+
+} // namespace rnoh
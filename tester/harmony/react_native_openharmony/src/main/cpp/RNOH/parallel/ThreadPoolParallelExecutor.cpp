@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "ThreadPoolParallelExecutor.h"
+
+namespace rnoh {
+
+thread_local ThreadPoolParallelExecutor::Loop*
+    ThreadPoolParallelExecutor::currentWorkerLoop = nullptr;
+
+ThreadPoolParallelExecutor::ThreadPoolParallelExecutor(size_t workersCount)
+    : ParallelExecutor(workersCount) {}
+
+ThreadPoolParallelExecutor::~ThreadPoolParallelExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_stopped = true;
+  }
+  m_cv.notify_all();
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPoolParallelExecutor::startWorkersIfNeeded() {
+  if (!m_workers.empty()) {
+    return;
+  }
+  // queue 0 belongs to the calling thread
+  for (size_t i = 1; i <= getWorkersCount(); i++) {
+    m_workers.emplace_back([this, i] { runWorker(i); });
+  }
+}
+
+void ThreadPoolParallelExecutor::run(
+    size_t chunksCount,
+    std::function<void(size_t)> const& runChunkAt) {
+  auto queuesCount = getWorkersCount() + 1;
+  auto loop = std::make_shared<Loop>(queuesCount, runChunkAt);
+  loop->remainingChunksCount = chunksCount;
+  // neighbouring chunks go to the same thread, unless they are stolen
+  for (size_t i = 0; i < chunksCount; i++) {
+    loop->queues[i * queuesCount / chunksCount].chunkIndexes.push_back(i);
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    startWorkersIfNeeded();
+    m_loop = loop;
+    m_loopGeneration++;
+  }
+  m_cv.notify_all();
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(loop->mtx);
+      runCallerThreadTasks(*loop, lock);
+    }
+    auto chunkIndex = claimChunk(*loop, 0);
+    if (!chunkIndex.has_value()) {
+      break;
+    }
+    runChunk(*loop, *chunkIndex);
+  }
+  {
+    std::unique_lock<std::mutex> lock(loop->mtx);
+    while (true) {
+      runCallerThreadTasks(*loop, lock);
+      if (loop->remainingChunksCount == 0) {
+        break;
+      }
+      loop->cv.wait(lock, [&] {
+        return loop->remainingChunksCount == 0 ||
+            !loop->callerThreadTasks.empty();
+      });
+    }
+  }
+  {
+    // another thread may have started a loop in the meantime
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (m_loop == loop) {
+      m_loop = nullptr;
+    }
+  }
+  if (loop->exception) {
+    std::rethrow_exception(loop->exception);
+  }
+}
+
+void ThreadPoolParallelExecutor::executeOnCallerThread(Task task) {
+  auto loop = currentWorkerLoop;
+  if (loop == nullptr) {
+    // a worker of another executor
+    task();
+    return;
+  }
+  CallerThreadTask callerThreadTask{std::move(task)};
+  {
+    std::unique_lock<std::mutex> lock(loop->mtx);
+    loop->callerThreadTasks.push_back(&callerThreadTask);
+    loop->cv.notify_all();
+    loop->cv.wait(lock, [&] { return callerThreadTask.isDone; });
+  }
+  if (callerThreadTask.exception) {
+    std::rethrow_exception(callerThreadTask.exception);
+  }
+}
+
+void ThreadPoolParallelExecutor::runWorker(size_t queueIndex) {
+  uint64_t seenLoopGeneration = 0;
+  while (true) {
+    std::shared_ptr<Loop> loop;
+    {
+      std::unique_lock<std::mutex> lock(m_mtx);
+      m_cv.wait(lock, [&] {
+        return m_stopped || m_loopGeneration != seenLoopGeneration;
+      });
+      if (m_stopped) {
+        return;
+      }
+      seenLoopGeneration = m_loopGeneration;
+      loop = m_loop;
+    }
+    if (loop == nullptr) {
+      continue;
+    }
+    WorkerThreadScope workerThreadScope;
+    currentWorkerLoop = loop.get();
+    while (auto chunkIndex = claimChunk(*loop, queueIndex)) {
+      runChunk(*loop, *chunkIndex);
+    }
+    currentWorkerLoop = nullptr;
+  }
+}
+
+std::optional<size_t> ThreadPoolParallelExecutor::claimChunk(
+    Loop& loop,
+    size_t queueIndex) {
+  {
+    auto& queue = loop.queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mtx);
+    if (!queue.chunkIndexes.empty()) {
+      auto chunkIndex = queue.chunkIndexes.front();
+      queue.chunkIndexes.pop_front();
+      return chunkIndex;
+    }
+  }
+  for (size_t i = 1; i < loop.queues.size(); i++) {
+    auto& queue = loop.queues[(queueIndex + i) % loop.queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mtx);
+    if (!queue.chunkIndexes.empty()) {
+      auto chunkIndex = queue.chunkIndexes.back();
+      queue.chunkIndexes.pop_back();
+      return chunkIndex;
+    }
+  }
+  return std::nullopt;
+}
+
+void ThreadPoolParallelExecutor::runChunk(Loop& loop, size_t chunkIndex) {
+  try {
+    loop.runChunkAt(chunkIndex);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(loop.mtx);
+    if (!loop.exception) {
+      loop.exception = std::current_exception();
+    }
+  }
+  if (loop.remainingChunksCount.fetch_sub(1) == 1) {
+    std::lock_guard<std::mutex> lock(loop.mtx);
+    loop.cv.notify_all();
+  }
+}
+
+void ThreadPoolParallelExecutor::runCallerThreadTasks(
+    Loop& loop,
+    std::unique_lock<std::mutex>& lock) {
+  while (!loop.callerThreadTasks.empty()) {
+    auto callerThreadTask = loop.callerThreadTasks.front();
+    loop.callerThreadTasks.pop_front();
+    lock.unlock();
+    try {
+      callerThreadTask->task();
+    } catch (...) {
+      callerThreadTask->exception = std::current_exception();
+    }
+    lock.lock();
+    callerThreadTask->isDone = true;
+    loop.cv.notify_all();
+  }
+}
+
+} // namespace rnoh
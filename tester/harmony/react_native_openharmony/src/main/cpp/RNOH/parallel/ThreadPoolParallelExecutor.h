@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "ParallelExecutor.h"
+
+namespace rnoh {
+
+/**
+ * @ThreadSafe
+ *
+ * A portable ParallelExecutor backed by std::threads. Chunks are dealt out
+ * to per-thread queues; a thread that runs out of chunks steals from the
+ * back of the other queues. Workers are started with the first loop.
+ */
+class ThreadPoolParallelExecutor : public ParallelExecutor {
+ public:
+  explicit ThreadPoolParallelExecutor(size_t workersCount);
+  ~ThreadPoolParallelExecutor() override;
+
+ protected:
+  void run(size_t chunksCount, std::function<void(size_t)> const& runChunkAt)
+      override;
+
+  void executeOnCallerThread(Task task) override;
+
+ private:
+  struct ChunkQueue {
+    std::mutex mtx;
+    std::deque<size_t> chunkIndexes;
+  };
+
+  struct CallerThreadTask {
+    Task task;
+    bool isDone = false;
+    std::exception_ptr exception = nullptr;
+  };
+
+  struct Loop {
+    Loop(size_t queuesCount, std::function<void(size_t)> const& runChunkAt)
+        : queues(queuesCount), runChunkAt(runChunkAt) {}
+
+    std::vector<ChunkQueue> queues;
+    std::function<void(size_t)> const& runChunkAt;
+    std::atomic<size_t> remainingChunksCount{0};
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<CallerThreadTask*> callerThreadTasks;
+    std::exception_ptr exception;
+  };
+
+  void startWorkersIfNeeded();
+  void runWorker(size_t queueIndex);
+  static std::optional<size_t> claimChunk(Loop& loop, size_t queueIndex);
+  static void runChunk(Loop& loop, size_t chunkIndex);
+  static void runCallerThreadTasks(
+      Loop& loop,
+      std::unique_lock<std::mutex>& lock);
+
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<std::thread> m_workers;
+  std::shared_ptr<Loop> m_loop;
+  uint64_t m_loopGeneration = 0;
+  bool m_stopped = false;
+
+  static thread_local Loop* currentWorkerLoop;
+};
+
+} // namespace rnoh
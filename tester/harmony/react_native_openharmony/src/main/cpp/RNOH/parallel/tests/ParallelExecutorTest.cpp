@@ -0,0 +1,317 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "RNOH/parallel/ParallelExecutor.h"
+#include "RNOH/parallel/ThreadPoolParallelExecutor.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t WORKERS_COUNT = 3;
+
+void iterationsCallingRunOnCallerThreadRunThemOnTheCallerThread() {
+  auto& executor = ParallelExecutor::getInstance();
+  // expensive enough to be split across all threads
+  ParallelExecutor::IterationCost cost(1ms);
+  constexpr size_t ITERATIONS_COUNT = 64;
+  auto callerThreadId = std::this_thread::get_id();
+  std::vector<std::atomic<int>> visitsCount(ITERATIONS_COUNT);
+  std::vector<std::thread::id> callerTaskThreadIds(ITERATIONS_COUNT);
+  std::atomic<size_t> workerIterationsCount{0};
+
+  executor.parallelFor(ITERATIONS_COUNT, cost, [&](size_t i) {
+    visitsCount[i]++;
+    if (std::this_thread::get_id() != callerThreadId) {
+      workerIterationsCount++;
+      CHECK(ParallelExecutor::isWorkerThread());
+    }
+    ParallelExecutor::runOnCallerThread(
+        [&] { callerTaskThreadIds[i] = std::this_thread::get_id(); });
+    std::this_thread::sleep_for(100us);
+  });
+
+  for (size_t i = 0; i < ITERATIONS_COUNT; i++) {
+    CHECK(visitsCount[i] == 1);
+    CHECK(callerTaskThreadIds[i] == callerThreadId);
+  }
+  CHECK(workerIterationsCount > 0);
+  CHECK(!ParallelExecutor::isWorkerThread());
+}
+
+void smallLoopsStayOnTheCallerThread() {
+  auto& executor = ParallelExecutor::getInstance();
+  ParallelExecutor::IterationCost cost(1us);
+  auto callerThreadId = std::this_thread::get_id();
+  size_t iterationsCount = 0;
+
+  executor.parallelFor(16, cost, [&](size_t /*i*/) {
+    CHECK(std::this_thread::get_id() == callerThreadId);
+    CHECK(!ParallelExecutor::isWorkerThread());
+    iterationsCount++;
+  });
+
+  CHECK(iterationsCount == 16);
+}
+
+void runOnCallerThreadOutsideOfLoopsRunsInline() {
+  auto callerThreadId = std::this_thread::get_id();
+  std::thread::id taskThreadId;
+  ParallelExecutor::runOnCallerThread(
+      [&] { taskThreadId = std::this_thread::get_id(); });
+  CHECK(taskThreadId == callerThreadId);
+}
+
+void exceptionsThrownByIterationsReachTheCaller() {
+  auto& executor = ParallelExecutor::getInstance();
+  ParallelExecutor::IterationCost cost(1ms);
+  bool caught = false;
+  try {
+    executor.parallelFor(64, cost, [](size_t i) {
+      if (i == 37) {
+        throw std::runtime_error("iteration 37");
+      }
+    });
+  } catch (std::runtime_error const& e) {
+    caught = std::string(e.what()) == "iteration 37";
+  }
+  CHECK(caught);
+}
+
+void exceptionsThrownOnTheCallerThreadReachTheIteration() {
+  auto& executor = ParallelExecutor::getInstance();
+  ParallelExecutor::IterationCost cost(1ms);
+  std::atomic<size_t> caughtCount{0};
+  executor.parallelFor(64, cost, [&](size_t /*i*/) {
+    try {
+      ParallelExecutor::runOnCallerThread(
+          [] { throw std::runtime_error("caller task"); });
+    } catch (std::runtime_error const&) {
+      caughtCount++;
+    }
+  });
+  CHECK(caughtCount == 64);
+}
+
+void executorCanBeReusedAfterAnException() {
+  auto& executor = ParallelExecutor::getInstance();
+  ParallelExecutor::IterationCost cost(1ms);
+  try {
+    executor.parallelFor(
+        64, cost, [](size_t /*i*/) { throw std::runtime_error("failed"); });
+  } catch (std::runtime_error const&) {
+  }
+  std::atomic<size_t> iterationsCount{0};
+  executor.parallelFor(64, cost, [&](size_t /*i*/) { iterationsCount++; });
+  CHECK(iterationsCount == 64);
+}
+
+void iterationCostLearnsFromSamples() {
+  ParallelExecutor::IterationCost cost(1ms);
+  cost.recordSample(10, 100us);
+  CHECK(cost.estimate() == 10us);
+  cost.recordSample(0, 1s);
+  CHECK(cost.estimate() == 10us);
+}
+
+/**
+ * Stands in for the JS runtime, which may only be used on the thread that
+ * started the loop and isn't thread safe.
+ */
+class FakeRuntime {
+ public:
+  std::string readProp(int tag) {
+    if (std::this_thread::get_id() != m_ownerThreadId) {
+      m_wasUsedOnOtherThread = true;
+    }
+    m_readTags.push_back(tag);
+    return getPropValue(tag);
+  }
+
+  static std::string getPropValue(int tag) {
+    return "value read from JS for node " + std::to_string(tag);
+  }
+
+  size_t getReadPropsCount() const {
+    return m_readTags.size();
+  }
+
+  bool wasUsedOnOtherThread() const {
+    return m_wasUsedOnOtherThread;
+  }
+
+ private:
+  std::thread::id m_ownerThreadId = std::this_thread::get_id();
+  std::vector<int> m_readTags;
+  bool m_wasUsedOnOtherThread = false;
+};
+
+/**
+ * Stands in for a shadow node: allocated by whichever thread runs the
+ * iteration, linked and released by the calling thread.
+ */
+struct Node {
+  int tag = 0;
+  std::string componentName;
+  std::unordered_map<std::string, std::string> props;
+  std::vector<std::shared_ptr<Node const>> children;
+};
+
+std::atomic<size_t> nodesCreatedOnWorkersCount{0};
+
+int getTag(size_t nodeIndex) {
+  return static_cast<int>(nodeIndex) * 2 + 1;
+}
+
+/**
+ * Creates nodes the way batchCreateNode does, where the props of every
+ * `fallbackInterval`-th node can only be read on the calling thread, then
+ * links them into a tree. Returns whether the tree is complete.
+ */
+bool createShadowTree(
+    FakeRuntime& runtime,
+    size_t nodesCount,
+    size_t fallbackInterval,
+    ParallelExecutor::IterationCost& cost) {
+  auto readPropsCountBefore = runtime.getReadPropsCount();
+  std::vector<std::shared_ptr<Node>> nodes(nodesCount);
+  ParallelExecutor::getInstance().parallelFor(nodesCount, cost, [&](size_t i) {
+    auto node = std::make_shared<Node>();
+    node->tag = getTag(i);
+    node->componentName = i % 2 == 0 ? "RCTView" : "RCTParagraph";
+    for (char prop = 'a'; prop < 'e'; prop++) {
+      // longer than the small string buffer, so that it's allocated
+      node->props[std::string(1, prop)] = std::string(40, prop);
+    }
+    if (i % fallbackInterval == 0) {
+      ParallelExecutor::runOnCallerThread(
+          [&] { node->props["fallback"] = runtime.readProp(node->tag); });
+    }
+    if (ParallelExecutor::isWorkerThread()) {
+      nodesCreatedOnWorkersCount++;
+    }
+    nodes[i] = std::move(node);
+  });
+  for (size_t i = 1; i < nodesCount; i++) {
+    nodes[(i - 1) / 2]->children.push_back(nodes[i]);
+  }
+
+  bool isComplete = !runtime.wasUsedOnOtherThread() &&
+      runtime.getReadPropsCount() - readPropsCountBefore ==
+          (nodesCount + fallbackInterval - 1) / fallbackInterval;
+  for (size_t i = 0; i < nodesCount && isComplete; i++) {
+    auto const& node = nodes[i];
+    auto hasFallback = i % fallbackInterval == 0;
+    isComplete = node != nullptr && node->tag == getTag(i) &&
+        node->props.size() == (hasFallback ? 5 : 4) &&
+        (!hasFallback ||
+         node->props.at("fallback") == FakeRuntime::getPropValue(getTag(i))) &&
+        node->children.size() ==
+            std::min<size_t>(nodesCount, 2 * i + 3) -
+                std::min<size_t>(nodesCount, 2 * i + 1);
+  }
+  return isComplete;
+}
+
+/**
+ * Creates trees of random sizes. Most of them start with a high cost
+ * estimate, so that they are split across the workers; the others use a
+ * learned estimate, like batchCreateNode does. Some loops throw midway.
+ */
+bool createRandomShadowTrees(unsigned seed, int treesCount) {
+  constexpr size_t FALLBACK_INTERVALS[] = {1, 7, 50, 5000};
+  std::mt19937 random(seed);
+  FakeRuntime runtime;
+  ParallelExecutor::IterationCost learnedCost(20us);
+  bool isConsistent = true;
+  for (int round = 0; round < treesCount; round++) {
+    size_t nodesCount = 1 + random() % 2000;
+    size_t fallbackInterval = FALLBACK_INTERVALS[random() % 4];
+    ParallelExecutor::IterationCost freshCost(20us);
+    auto& cost = round % 4 == 0 ? learnedCost : freshCost;
+    if (round % 10 == 9) {
+      auto throwingIndex = random() % nodesCount;
+      bool didThrow = false;
+      try {
+        ParallelExecutor::getInstance().parallelFor(
+            nodesCount, cost, [&](size_t i) {
+              if (i == throwingIndex) {
+                throw std::runtime_error("failed to create a node");
+              }
+            });
+      } catch (std::runtime_error const&) {
+        didThrow = true;
+      }
+      isConsistent = isConsistent && didThrow;
+      continue;
+    }
+    isConsistent = isConsistent &&
+        createShadowTree(runtime, nodesCount, fallbackInterval, cost);
+  }
+  return isConsistent;
+}
+
+void createsShadowTreesUnderStress() {
+  nodesCreatedOnWorkersCount = 0;
+  CHECK(createRandomShadowTrees(1, 100));
+  CHECK(nodesCreatedOnWorkersCount > 0);
+}
+
+void createsShadowTreesFromConcurrentCallers() {
+  // e.g. the JS threads of two RN instances
+  constexpr unsigned CALLERS_COUNT = 2;
+  std::vector<std::thread> callers;
+  std::atomic<bool> isConsistent = true;
+  for (unsigned i = 0; i < CALLERS_COUNT; i++) {
+    callers.emplace_back([&isConsistent, i] {
+      if (!createRandomShadowTrees(i + 2, 50)) {
+        isConsistent = false;
+      }
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  CHECK(isConsistent);
+}
+
+} // namespace
+
+int main() {
+  ParallelExecutor::setInstance(
+      std::make_unique<ThreadPoolParallelExecutor>(WORKERS_COUNT));
+  auto result = testing::runTests({
+      {"iterationsCallingRunOnCallerThreadRunThemOnTheCallerThread",
+       iterationsCallingRunOnCallerThreadRunThemOnTheCallerThread},
+      {"smallLoopsStayOnTheCallerThread", smallLoopsStayOnTheCallerThread},
+      {"runOnCallerThreadOutsideOfLoopsRunsInline",
+       runOnCallerThreadOutsideOfLoopsRunsInline},
+      {"exceptionsThrownByIterationsReachTheCaller",
+       exceptionsThrownByIterationsReachTheCaller},
+      {"exceptionsThrownOnTheCallerThreadReachTheIteration",
+       exceptionsThrownOnTheCallerThreadReachTheIteration},
+      {"executorCanBeReusedAfterAnException",
+       executorCanBeReusedAfterAnException},
+      {"iterationCostLearnsFromSamples", iterationCostLearnsFromSamples},
+      {"createsShadowTreesUnderStress", createsShadowTreesUnderStress},
+      {"createsShadowTreesFromConcurrentCallers",
+       createsShadowTreesFromConcurrentCallers},
+  });
+  ParallelExecutor::setInstance(nullptr);
+  return result;
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#ifndef JSVM_CODE_CACHE_H
+#define JSVM_CODE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rnjsvm {
+
+/**
+ * A JSVM code cache file mapped into memory. The file starts with a header
+ * that records the hash of the bundle the cache was created for, the code
+ * cache version tag of the engine and the checksum of the cache data, so
+ * that stale or corrupt caches are rejected before they reach
+ * `OH_JSVM_CompileScript`. `data()` points into the mapping, so cache hits
+ * don't copy the cache.
+ *
+ * Mapped caches are kept for the lifetime of the process and shared by all
+ * runtimes.
+ */
+class JSVMCodeCache {
+ public:
+  using Shared = std::shared_ptr<const JSVMCodeCache>;
+
+  ~JSVMCodeCache();
+
+  JSVMCodeCache(const JSVMCodeCache&) = delete;
+  JSVMCodeCache& operator=(const JSVMCodeCache&) = delete;
+
+  /**
+   * Returns nullptr when there's no valid cache at `path` for the bundle.
+   * Reports the lookup through HarmonyReactMarker.
+   */
+  static Shared get(
+      const std::string& path,
+      uint64_t bundleHash,
+      uint32_t engineVersionTag);
+
+  /**
+   * Atomically replaces the cache file at `path`.
+   */
+  static void update(
+      const std::string& path,
+      uint64_t bundleHash,
+      uint32_t engineVersionTag,
+      const uint8_t* data,
+      size_t size);
+
+  /**
+   * A fast non-cryptographic hash, used for bundles and cache checksums.
+   */
+  static uint64_t hash(const uint8_t* data, size_t size);
+
+  const uint8_t* data() const;
+  size_t size() const;
+
+ private:
+  struct Header {
+    uint32_t magic;
+    uint32_t formatVersion;
+    uint32_t engineVersionTag;
+    uint32_t reserved;
+    uint64_t bundleHash;
+    uint64_t dataSize;
+    uint64_t dataChecksum;
+  };
+
+  JSVMCodeCache(void* mapping, size_t mappingSize);
+
+  static Shared map(
+      const std::string& path,
+      uint64_t bundleHash,
+      uint32_t engineVersionTag);
+
+  const Header& header() const;
+
+  void* m_mapping;
+  size_t m_mappingSize;
+
+  static std::mutex cacheMtx;
+  static std::unordered_map<std::string, Shared> cacheByPath;
+};
+
+} // namespace rnjsvm
+
+#endif
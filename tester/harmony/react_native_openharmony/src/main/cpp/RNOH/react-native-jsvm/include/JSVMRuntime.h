@@ -13,6 +13,7 @@
 #include <cxxreact/MessageQueueThread.h>
 #include <react/debug/react_native_assert.h>
 #include "JSVMUtil.h"
+#include "JSVMCodeCache.h"
 #include "folly/dynamic.h"
 #include <jsi/instrumentation.h>
 #include <chrono>
@@ -23,6 +24,7 @@ namespace rnjsvm {
 class JSVMRuntime;
 class JSVMPointerValue;
 class JSVMConverter;
+class HostObjectProxy;
 
 class JSVMRuntime : public Runtime {
  public:
@@ -155,22 +157,43 @@ class JSVMRuntime : public Runtime {
       size_t length,
       JSVM_Value* args,
       uint32_t argc);
-  std::vector<uint8_t> GetCodeCache(const std::string &sourceURL);
-  void UpdateCodeCache(const std::string &sourceURL, const std::vector<uint8_t>& buffer);
+  JSVMCodeCache::Shared GetCodeCache(
+      const std::string& sourceURL,
+      uint64_t bundleHash);
+  void UpdateCodeCache(
+      const std::string& sourceURL,
+      uint64_t bundleHash,
+      const uint8_t* data,
+      size_t size);
+
+  /**
+   * Returns the interned PropNameID for a property name string received from
+   * JSVM, e.g. in HostObjectProxy callbacks. Other names, such as symbols,
+   * get a new PropNameID.
+   */
+  PropNameID createPropNameIDFromJSVM(JSVM_Value value);
+
  private:
+  // Hot property names are interned: the cache keeps a reference to a single
+  // PropNameID per name, so creating one again only bumps its refcount, and
+  // utf8() returns the cached name without going through JSVM. Names are
+  // interned until the cache is full and live as long as the runtime.
+  static constexpr size_t MAX_INTERNED_PROP_NAME_LENGTH = 64;
+  static constexpr size_t MAX_INTERNED_PROP_NAMES_COUNT = 2048;
+  JSVMPointerValue* GetInternedPropName(const char* str, size_t length);
+  JSVMPointerValue* InternPropName(std::string name, JSVM_Value value);
+  void ReleaseInternedPropNames();
+  std::unordered_map<std::string, JSVMPointerValue*> internedPropNames;
+  std::unordered_map<const Runtime::PointerValue*, const std::string*>
+      internedPropNameUtf8s;
+
   JSVM_CreateVMOptions options;
   JSVM_VM vm;
   JSVM_VMScope vmScope;
   JSVM_Env env;
   JSVM_EnvScope envScope;
-  static std::mutex codeCacheMtx;
-  // L1 code cahce is in the disk
-  // L2 code cache is in the memory
-  static std::unordered_map<std::string, std::vector<uint8_t>> codeCacheL2;
-  std::vector<uint8_t> GetCodeCacheL1(const std::string &sourceURL);
-  void UpdateCodeCacheL1(const std::string &sourceURL, const std::vector<uint8_t>& buffer);
-  std::vector<uint8_t> GetCodeCacheL2(const std::string &sourceURL);
-  void UpdateCodeCacheL2(const std::string &sourceURL, const std::vector<uint8_t>& buffer);
+  // code caches are files mapped into memory by JSVMCodeCache
+  static uint32_t GetEngineVersionTag();
   const char *cachePath = "/data/storage/el2/base/cache/js";
   static bool initialized;
   std::shared_ptr<facebook::react::MessageQueueThread> jsQueue;
@@ -223,6 +246,7 @@ class JSVMRuntime : public Runtime {
     };
   friend class JSVMPointerValue;
   friend class JSVMConverter;
+  friend class HostObjectProxy;
 };
 
 class JSVMPointerValue : public JSVMRuntime::PointerValue {
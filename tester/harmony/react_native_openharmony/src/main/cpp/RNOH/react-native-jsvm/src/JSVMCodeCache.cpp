@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "JSVMCodeCache.h"
+#include <fcntl.h>
+#include <glog/logging.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include "RNOH/Performance/HarmonyReactMarker.h"
+
+namespace rnjsvm {
+
+// "RNJC" in little endian
+static constexpr uint32_t CODE_CACHE_MAGIC = 0x434A4E52;
+static constexpr uint32_t CODE_CACHE_FORMAT_VERSION = 1;
+
+std::mutex JSVMCodeCache::cacheMtx;
+std::unordered_map<std::string, JSVMCodeCache::Shared>
+    JSVMCodeCache::cacheByPath = {};
+
+JSVMCodeCache::JSVMCodeCache(void* mapping, size_t mappingSize)
+    : m_mapping(mapping), m_mappingSize(mappingSize) {}
+
+JSVMCodeCache::~JSVMCodeCache() {
+  munmap(m_mapping, m_mappingSize);
+}
+
+const JSVMCodeCache::Header& JSVMCodeCache::header() const {
+  return *static_cast<const Header*>(m_mapping);
+}
+
+const uint8_t* JSVMCodeCache::data() const {
+  return static_cast<const uint8_t*>(m_mapping) + sizeof(Header);
+}
+
+size_t JSVMCodeCache::size() const {
+  return header().dataSize;
+}
+
+uint64_t JSVMCodeCache::hash(const uint8_t* data, size_t size) {
+  constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+  uint64_t result = size * MULTIPLIER;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    result = (result ^ word) * MULTIPLIER;
+    result ^= result >> 32;
+  }
+  uint64_t tail = 0;
+  std::memcpy(&tail, data + i, size - i);
+  result = (result ^ tail) * MULTIPLIER;
+  return result ^ (result >> 29);
+}
+
+JSVMCodeCache::Shared JSVMCodeCache::get(
+    const std::string& path,
+    uint64_t bundleHash,
+    uint32_t engineVersionTag) {
+  using rnoh::HarmonyReactMarker;
+  HarmonyReactMarker::logMarker(
+      HarmonyReactMarker::HarmonyReactMarkerId::JSVM_CODE_CACHE_LOOKUP_START,
+      path.c_str());
+  Shared cache;
+  {
+    std::lock_guard<std::mutex> lock(cacheMtx);
+    if (auto it = cacheByPath.find(path); it != cacheByPath.end()) {
+      auto const& header = it->second->header();
+      if (header.bundleHash == bundleHash &&
+          header.engineVersionTag == engineVersionTag) {
+        DLOG(INFO) << "L2 CACHE HIT: " << path;
+        cache = it->second;
+      } else {
+        cacheByPath.erase(it);
+      }
+    }
+  }
+  if (cache == nullptr) {
+    cache = map(path, bundleHash, engineVersionTag);
+    if (cache != nullptr) {
+      std::lock_guard<std::mutex> lock(cacheMtx);
+      cacheByPath[path] = cache;
+    }
+  }
+  HarmonyReactMarker::logMarker(
+      HarmonyReactMarker::HarmonyReactMarkerId::JSVM_CODE_CACHE_LOOKUP_STOP,
+      path.c_str());
+  HarmonyReactMarker::logMarker(
+      HarmonyReactMarker::HarmonyReactMarkerId::JSVM_CODE_CACHE_SIZE,
+      std::to_string(cache != nullptr ? cache->size() : 0).c_str());
+  return cache;
+}
+
+JSVMCodeCache::Shared JSVMCodeCache::map(
+    const std::string& path,
+    uint64_t bundleHash,
+    uint32_t engineVersionTag) {
+  auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    DLOG(INFO) << "L1 CACHE MISS: " << path;
+    return nullptr;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) <= sizeof(Header)) {
+    close(fd);
+    LOG(WARNING) << "Rejected code cache without data: " << path;
+    return nullptr;
+  }
+  size_t mappingSize = fileStat.st_size;
+  auto mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping stays valid after the descriptor is closed
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    LOG(ERROR) << "Couldn't map code cache: " << path;
+    return nullptr;
+  }
+  Shared cache(new JSVMCodeCache(mapping, mappingSize));
+  auto const& header = cache->header();
+  if (header.magic != CODE_CACHE_MAGIC ||
+      header.formatVersion != CODE_CACHE_FORMAT_VERSION) {
+    LOG(WARNING) << "Rejected code cache in unknown format: " << path;
+    return nullptr;
+  }
+  if (header.engineVersionTag != engineVersionTag ||
+      header.bundleHash != bundleHash) {
+    DLOG(INFO) << "Rejected stale code cache: " << path;
+    return nullptr;
+  }
+  if (header.dataSize != mappingSize - sizeof(Header) ||
+      hash(cache->data(), cache->size()) != header.dataChecksum) {
+    LOG(WARNING) << "Rejected corrupt code cache: " << path;
+    return nullptr;
+  }
+  DLOG(INFO) << "L1 CACHE HIT: " << path << "; size = " << cache->size();
+  return cache;
+}
+
+void JSVMCodeCache::update(
+    const std::string& path,
+    uint64_t bundleHash,
+    uint32_t engineVersionTag,
+    const uint8_t* data,
+    size_t size) {
+  DLOG(INFO) << "Update L1 CACHE: " << path << "; size = " << size;
+  {
+    // the next lookup maps the new file
+    std::lock_guard<std::mutex> lock(cacheMtx);
+    cacheByPath.erase(path);
+  }
+
+  namespace fs = std::filesystem;
+
+  fs::path targetPath = path;
+  std::error_code ec;
+  fs::create_directories(targetPath.parent_path(), ec);
+
+  std::string tmpSuffix = ".tmp_" + std::to_string(getpid()) + "_" +
+      std::to_string(std::random_device{}());
+  fs::path tmpPath = path + tmpSuffix;
+
+  Header header{
+      CODE_CACHE_MAGIC,
+      CODE_CACHE_FORMAT_VERSION,
+      engineVersionTag,
+      0,
+      bundleHash,
+      size,
+      hash(data, size)};
+  auto fileSize = sizeof(Header) + size;
+
+  std::ofstream outFile(tmpPath, std::ios::binary | std::ios::out);
+  if (outFile) {
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    outFile.write(reinterpret_cast<const char*>(data), size);
+    outFile.close();
+
+    if (!outFile.fail() && fs::file_size(tmpPath, ec) == fileSize) {
+      std::error_code ec_perm;
+      fs::permissions(
+          tmpPath,
+          fs::perms::owner_write | fs::perms::group_write |
+              fs::perms::others_write,
+          fs::perm_options::remove,
+          ec_perm);
+
+      if (ec_perm) {
+        LOG(ERROR) << "Set read-only failed for temp file: " << tmpPath;
+        fs::remove(tmpPath, ec);
+        LOG(ERROR) << "Updating L1 CACHE failed: " << path;
+        return;
+      }
+
+      std::error_code ec_rename;
+      fs::rename(tmpPath, targetPath, ec_rename);
+
+      if (!ec_rename) {
+        DLOG(INFO) << "Updating L1 CACHE success: " << path;
+        return;
+      }
+      LOG(ERROR) << "Rename failed: " << ec_rename.message();
+    } else {
+      LOG(ERROR) << "Write incomplete to temp file: " << tmpPath;
+    }
+    fs::remove(tmpPath, ec);
+  } else {
+    LOG(ERROR) << "Open temp file failed: " << tmpPath;
+  }
+  LOG(ERROR) << "Updating L1 CACHE failed: " << path;
+}
+
+} // namespace rnjsvm
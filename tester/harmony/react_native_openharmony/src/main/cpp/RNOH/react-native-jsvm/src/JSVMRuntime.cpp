@@ -7,15 +7,15 @@
  
 #include "JSVMRuntime.h"
 #include "JSVMConverter.h"
+#include "JSVMCodeCache.h"
 #include <glog/logging.h>
 #include "mutex.h"
 #include "hostProxy.h"
 #include "JSVMUtil.h"
 #include <algorithm>
+#include <cstring>
 #include <cctype>
 #include <filesystem>
-#include <fstream>
-#include <random>
 #include "RNOH/Assert.h"
 
 #define DFX()                  \
@@ -27,8 +27,6 @@
 namespace rnjsvm {
 
 bool JSVMRuntime::initialized = false;
-std::mutex JSVMRuntime::codeCacheMtx;
-std::unordered_map<std::string, std::vector<uint8_t>> JSVMRuntime::codeCacheL2 = {};
 thread_local bool JSVMPointerValue::isJsThread = false;
 thread_local JSVMPointerValue *JSVMPointerValue::head = nullptr;
 
@@ -77,6 +75,7 @@ JSVMRuntime::JSVMRuntime(
 JSVMRuntime::~JSVMRuntime()
 {
     JSVMPointerValue::ReleasePointerValueList();
+    ReleaseInternedPropNames();
     OH_JSVM_CloseEnvScope(env, envScope);
     OH_JSVM_DestroyEnv(env);
     OH_JSVM_CloseVMScope(vm, vmScope);
@@ -95,23 +94,25 @@ Value JSVMRuntime::evaluateJavaScript(const std::shared_ptr<const Buffer> &buffe
     std::string name = std::filesystem::is_regular_file(sourceURL)
       ? cachePath + sourceURL
       : (cachePath/std::filesystem::path(sourceURL)).string();
-    auto cache = GetCodeCache(name);
+    auto bundleHash = JSVMCodeCache::hash(buffer->data(), buffer->size());
+    auto cache = GetCodeCache(name, bundleHash);
 
     // Memory leaks! OH_JSVM_ReleaseScript not available on NEXT-DB3
     auto script = std::make_shared<JSVM_Script>();
 
-    CALL_JSVM_AND_THROW(OH_JSVM_CompileScript(env, *jsSrc, cache.empty() ? nullptr : cache.data(), cache.size(), true,
-      &cacheRejected, script.get()));
+    // the cache is compiled straight from its file mapping
+    CALL_JSVM_AND_THROW(OH_JSVM_CompileScript(env, *jsSrc, cache ? cache->data() : nullptr,
+      cache ? cache->size() : 0, true, &cacheRejected, script.get()));
 
     // 执行js代码
     auto result = std::make_shared<JSVM_Value>();
     CALL_JSVM_AND_THROW(OH_JSVM_RunScript(env, *script, result.get()));
 
-    if (cache.empty() || cacheRejected) {
+    if (!cache || cacheRejected) {
       const uint8_t* data;
       size_t len;
       CALL_JSVM_AND_THROW(OH_JSVM_CreateCodeCache(env, *script, &data, &len));
-      UpdateCodeCache(name, {data, data + len});
+      UpdateCodeCache(name, bundleHash, data, len);
       CALL_JSVM_AND_THROW(OH_JSVM_ReleaseCache(env, data, JSVM_CACHE_TYPE_JS));
     }
 
@@ -261,24 +262,87 @@ Runtime::PointerValue* JSVMRuntime::clonePropNameID(
   return clone(pv);
 }
 
+JSVMPointerValue* JSVMRuntime::GetInternedPropName(const char* str, size_t length)
+{
+    if (length > MAX_INTERNED_PROP_NAME_LENGTH) {
+        return nullptr;
+    }
+    auto it = internedPropNames.find(std::string(str, length));
+    return it != internedPropNames.end() ? it->second->Ref() : nullptr;
+}
+
+JSVMPointerValue* JSVMRuntime::InternPropName(std::string name, JSVM_Value value)
+{
+    auto pv = JSVMPointerValue::New<false>(env, value);
+    if (name.size() > MAX_INTERNED_PROP_NAME_LENGTH ||
+        internedPropNames.size() >= MAX_INTERNED_PROP_NAMES_COUNT) {
+        return pv;
+    }
+    auto [it, inserted] = internedPropNames.try_emplace(std::move(name), pv);
+    if (inserted) {
+        pv->Ref();
+        internedPropNameUtf8s.emplace(pv, &it->first);
+    }
+    return pv;
+}
+
+void JSVMRuntime::ReleaseInternedPropNames()
+{
+    // JSVM references are already deleted together with all other pointer values,
+    // this only drops the references held by the cache
+    internedPropNameUtf8s.clear();
+    for (auto& [name, pv] : internedPropNames) {
+        pv->invalidate();
+    }
+    internedPropNames.clear();
+}
+
 PropNameID JSVMRuntime::createPropNameIDFromAscii(const char *str, size_t length)
 {
     DFX();
+    if (auto pv = GetInternedPropName(str, length)) {
+        return make<PropNameID>(pv);
+    }
     JSVMUtil::HandleScopeWrapper scope(env);
 
     JSVM_Value value = nullptr;
     OH_JSVM_CreateStringLatin1(env, str, length, &value);
-    return JSVMConverter::make<PropNameID>(env, value);
+    return make<PropNameID>(InternPropName(std::string(str, length), value));
 }
 
 PropNameID JSVMRuntime::createPropNameIDFromUtf8(const uint8_t *utf8, size_t length)
 {
     DFX();
+    auto str = reinterpret_cast<const char*>(utf8);
+    if (auto pv = GetInternedPropName(str, length)) {
+        return make<PropNameID>(pv);
+    }
     JSVMUtil::HandleScopeWrapper scope(env);
 
     JSVM_Value value = nullptr;
-    OH_JSVM_CreateStringUtf8(env, reinterpret_cast<const char*>(utf8), length, &value);
-    return JSVMConverter::make<PropNameID>(env, value);
+    OH_JSVM_CreateStringUtf8(env, str, length, &value);
+    return make<PropNameID>(InternPropName(std::string(str, length), value));
+}
+
+PropNameID JSVMRuntime::createPropNameIDFromJSVM(JSVM_Value value)
+{
+    DFX();
+    JSVM_ValueType type = JSVM_UNDEFINED;
+    OH_JSVM_Typeof(env, value, &type);
+    if (type != JSVM_STRING) {
+        return JSVMConverter::make<PropNameID>(env, value);
+    }
+    // a name that fills the buffer may have been truncated
+    char buffer[MAX_INTERNED_PROP_NAME_LENGTH + 2];
+    size_t length = 0;
+    OH_JSVM_GetValueStringUtf8(env, value, buffer, sizeof(buffer), &length);
+    if (length > MAX_INTERNED_PROP_NAME_LENGTH) {
+        return JSVMConverter::make<PropNameID>(env, value);
+    }
+    if (auto pv = GetInternedPropName(buffer, length)) {
+        return make<PropNameID>(pv);
+    }
+    return make<PropNameID>(InternPropName(std::string(buffer, length), value));
 }
 
 PropNameID JSVMRuntime::createPropNameIDFromString(const String &str)
@@ -301,6 +365,10 @@ PropNameID JSVMRuntime::createPropNameIDFromSymbol(const Symbol &sym)
 
 std::string JSVMRuntime::utf8(const PropNameID& propNameID) {
   DFX();
+  if (auto it = internedPropNameUtf8s.find(getPointerValue(propNameID));
+      it != internedPropNameUtf8s.end()) {
+    return *it->second;
+  }
   JSVMUtil::HandleScopeWrapper scope(env);
   JSVM_Value value = JSVMConverter::PointerValueToJSVM(env, propNameID);
   bool isSymbol = false;
@@ -321,6 +389,10 @@ std::string JSVMRuntime::utf8(const PropNameID& propNameID) {
 bool JSVMRuntime::compare(const PropNameID &propNameID1, const PropNameID &propNameID2)
 {
     DFX();
+    // interned names share their pointer value
+    if (getPointerValue(propNameID1) == getPointerValue(propNameID2)) {
+        return true;
+    }
     JSVMUtil::HandleScopeWrapper scope(env);
 
     JSVM_Value lvalue = JSVMConverter::PointerValueToJSVM(env, propNameID1);
@@ -832,6 +904,9 @@ ArrayBuffer JSVMRuntime::createArrayBuffer(std::shared_ptr<MutableBuffer> buffer
     JSVM_Value ptr = nullptr;
     void *arrayBufferPtr = nullptr;
     CALL_JSVM(env, OH_JSVM_CreateArraybuffer(env, buffer->size(), &arrayBufferPtr, &ptr));
+    if (buffer->size() > 0) {
+        std::memcpy(arrayBufferPtr, buffer->data(), buffer->size());
+    }
     return JSVMConverter::make<Object>(env, ptr).getArrayBuffer(*this);
 }
 
@@ -1070,103 +1145,31 @@ inline JSVM_Value JSVMRuntime::CallGlobalFunction(
   return result;
 }
 
-std::vector<uint8_t> JSVMRuntime::GetCodeCache(const std::string &sourceURL) {
-  return GetCodeCacheL2(sourceURL);
-}
-
-void JSVMRuntime::UpdateCodeCache(const std::string &sourceURL, const std::vector<uint8_t>& buffer) {
-  UpdateCodeCacheL1(sourceURL, buffer);
-}
-
-std::vector<uint8_t> JSVMRuntime::GetCodeCacheL1(const std::string &sourceURL) {
-  try {
-    std::ifstream file(sourceURL, std::ifstream::binary);
-    file.seekg(0, std::ios::end);
-    auto size = file.tellg();
-    file.seekg(0, std::ios::beg);
-    std::vector<uint8_t> buffer(size);
-    file.read(reinterpret_cast<char*>(buffer.data()), size);
-    DLOG(INFO) << "L1 CACHE HIT: " << sourceURL << "; size = " << size;
-    UpdateCodeCacheL2(sourceURL, buffer);
-    return buffer;
-  } catch (...) {
-    DLOG(INFO) << "L1 CACHE MISS: " << sourceURL;
-    return std::vector<uint8_t>{};
-  }
-}
-
-void JSVMRuntime::UpdateCodeCacheL1(
+JSVMCodeCache::Shared JSVMRuntime::GetCodeCache(
     const std::string& sourceURL,
-    const std::vector<uint8_t>& buffer) {
-  DLOG(INFO) << "Update L1 CACHE: " << sourceURL
-             << "; size = " << buffer.size();
-
-  namespace fs = std::filesystem;
-
-  fs::path targetPath = sourceURL;
-  fs::create_directories(targetPath.parent_path());
-
-  std::string tmpSuffix = ".tmp_" + std::to_string(getpid()) + "_" +
-      std::to_string(std::random_device{}());
-  fs::path tmpPath = sourceURL + tmpSuffix;
-
-  std::ofstream outFile(tmpPath, std::ios::binary | std::ios::out);
-  if (outFile) {
-    outFile.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
-    outFile.close();
-
-    if (!outFile.fail() && fs::file_size(tmpPath) == buffer.size()) {
-      std::error_code ec_perm;
-      fs::permissions(
-          tmpPath,
-          fs::perms::owner_write | fs::perms::group_write |
-              fs::perms::others_write,
-          fs::perm_options::remove,
-          ec_perm);
-
-      if (ec_perm) {
-        LOG(ERROR) << "Set read-only failed for temp file: " << tmpPath;
-        fs::remove(tmpPath);
-        LOG(ERROR) << "Updating L1 CACHE failed: " << sourceURL;
-        return;
-      }
-
-      std::error_code ec_rename;
-      fs::rename(tmpPath, targetPath, ec_rename);
-
-      if (!ec_rename) {
-        DLOG(INFO) << "Updating L1 CACHE success: " << sourceURL;
-        UpdateCodeCacheL2(sourceURL, buffer);
-        return;
-      }
-      LOG(ERROR) << "Rename failed: " << ec_rename.message();
-    } else {
-      LOG(ERROR) << "Write incomplete to temp file: " << tmpPath;
-    }
-    fs::remove(tmpPath);
-  } else {
-    LOG(ERROR) << "Open temp file failed: " << tmpPath;
-  }
-  LOG(ERROR) << "Updating L1 CACHE failed: " << sourceURL;
+    uint64_t bundleHash) {
+  return JSVMCodeCache::get(sourceURL, bundleHash, GetEngineVersionTag());
 }
 
-std::vector<uint8_t> JSVMRuntime::GetCodeCacheL2(const std::string &sourceURL) {
-  {
-    std::lock_guard<std::mutex> lock(codeCacheMtx);
-    if (auto it = codeCacheL2.find(sourceURL); it != codeCacheL2.end()) {
-      DLOG(INFO) << "L2 CACHE HIT: " << sourceURL
-                 << "; size = " << it->second.size();
-      return it->second;
+void JSVMRuntime::UpdateCodeCache(
+    const std::string& sourceURL,
+    uint64_t bundleHash,
+    const uint8_t* data,
+    size_t size) {
+  JSVMCodeCache::update(
+      sourceURL, bundleHash, GetEngineVersionTag(), data, size);
+}
+
+uint32_t JSVMRuntime::GetEngineVersionTag() {
+  // caches created by a different engine build are rejected before compiling
+  static uint32_t engineVersionTag = [] {
+    JSVM_VMInfo vmInfo;
+    if (OH_JSVM_GetVMInfo(&vmInfo) != JSVM_OK) {
+      return uint32_t{0};
     }
-    DLOG(INFO) << "L2 CACHE MISS: " << sourceURL;
-  }
-  return GetCodeCacheL1(sourceURL);
-}
-
-void JSVMRuntime::UpdateCodeCacheL2(const std::string &sourceURL, const std::vector<uint8_t>& buffer) {
-  std::lock_guard<std::mutex> lock(codeCacheMtx);
-  DLOG(INFO) << "Update L2 CACHE: " << sourceURL << "; size = " << buffer.size();
-  codeCacheL2[sourceURL] = buffer;
+    return vmInfo.cachedDataVersionTag;
+  }();
+  return engineVersionTag;
 }
 
 void JSVMRuntime::ThrowError() {
@@ -52,7 +52,7 @@ JSVM_Value HostObjectProxy::Getter(
   Value ret = Value::undefined();
   try {
     ret = hostObjectProxy->hostObject->get(
-        hostObjectProxy->rt, JSVMConverter::make<PropNameID>(env, name));
+        hostObjectProxy->rt, hostObjectProxy->rt.createPropNameIDFromJSVM(name));
   } catch (const JSError& error) {
     JSVM_Value errorValue = JSVMConverter::JsiToJSVM(env, error.value());
     OH_JSVM_Throw(env, errorValue);
@@ -89,7 +89,7 @@ JSVM_Value HostObjectProxy::Setter(
   try {
     hostObjectProxy->hostObject->set(
         hostObjectProxy->rt,
-        JSVMConverter::make<PropNameID>(env, name),
+        hostObjectProxy->rt.createPropNameIDFromJSVM(name),
         JSVMConverter::JSVMToJsi(env, property));
   } catch (const JSError& error) {
     JSVM_Value errorValue = JSVMConverter::JsiToJSVM(env, error.value());
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <hilog/log.h>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RNOH/AsyncLogWriter.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+
+namespace {
+
+struct LoggedLine {
+  LogLevel level;
+  std::string tag;
+  std::string text;
+};
+
+std::mutex loggedLinesMtx;
+std::vector<LoggedLine> loggedLines;
+
+std::vector<LoggedLine> getLoggedLines(std::string const& tag) {
+  std::lock_guard lock(loggedLinesMtx);
+  std::vector<LoggedLine> lines;
+  for (auto const& line : loggedLines) {
+    if (line.tag == tag) {
+      lines.push_back(line);
+    }
+  }
+  return lines;
+}
+
+size_t getDroppedLinesCount() {
+  std::lock_guard lock(loggedLinesMtx);
+  size_t droppedLinesCount = 0;
+  for (auto const& line : loggedLines) {
+    auto suffix = std::string(" log lines dropped");
+    if (line.text.size() > suffix.size() &&
+        line.text.compare(
+            line.text.size() - suffix.size(), suffix.size(), suffix) == 0) {
+      droppedLinesCount += std::stoul(line.text);
+    }
+  }
+  return droppedLinesCount;
+}
+
+void runOnOtherThread(std::function<void()> work) {
+  std::thread(std::move(work)).join();
+}
+
+void flushWritesQueuedLinesInOrder() {
+  auto& writer = AsyncLogWriter::getInstance();
+  for (int i = 0; i < 10; i++) {
+    CHECK(writer.write(
+        LOG_INFO, "order", {"line ", std::to_string(i), " of ", "10"}));
+  }
+  writer.flush();
+  auto lines = getLoggedLines("order");
+  CHECK(lines.size() == 10);
+  for (size_t i = 0; i < lines.size(); i++) {
+    CHECK(lines[i].level == LOG_INFO);
+    CHECK(lines[i].text == "line " + std::to_string(i) + " of 10");
+  }
+}
+
+void rejectsLinesLongerThanASlot() {
+  auto& writer = AsyncLogWriter::getInstance();
+  std::string longestLine(AsyncLogWriter::MAX_LINE_LENGTH, 'x');
+  CHECK(!writer.write(LOG_WARN, "long", {longestLine, "x"}));
+  CHECK(writer.write(LOG_WARN, "long", {longestLine}));
+  writer.flush();
+  auto lines = getLoggedLines("long");
+  CHECK(lines.size() == 1);
+  CHECK(!lines.empty() && lines[0].text == longestLine);
+}
+
+void drainsWithoutFlush() {
+  runOnOtherThread([] {
+    CHECK(AsyncLogWriter::getInstance().write(LOG_ERROR, "drainer", {"x"}));
+  });
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (getLoggedLines("drainer").empty() &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  CHECK(getLoggedLines("drainer").size() == 1);
+}
+
+void keepsTheOrderOfEveryThreadAndReportsDrops() {
+  constexpr int THREADS_COUNT = 4;
+  constexpr int LINES_PER_THREAD = 20000;
+  auto droppedLinesCountBefore = getDroppedLinesCount();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS_COUNT; t++) {
+    threads.emplace_back([t] {
+      for (int i = 0; i < LINES_PER_THREAD; i++) {
+        AsyncLogWriter::getInstance().write(
+            LOG_DEBUG,
+            "producers",
+            {std::to_string(t), ":", std::to_string(i)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  AsyncLogWriter::getInstance().flush();
+  auto lines = getLoggedLines("producers");
+  std::vector<int> lastIndexByThread(THREADS_COUNT, -1);
+  bool isOrdered = true;
+  for (auto const& line : lines) {
+    auto separator = line.text.find(':');
+    auto t = std::stoi(line.text.substr(0, separator));
+    auto i = std::stoi(line.text.substr(separator + 1));
+    isOrdered = isOrdered && i > lastIndexByThread[t];
+    lastIndexByThread[t] = i;
+  }
+  CHECK(isOrdered);
+  CHECK(
+      lines.size() + getDroppedLinesCount() - droppedLinesCountBefore ==
+      THREADS_COUNT * LINES_PER_THREAD);
+}
+
+} // namespace
+
+extern "C" int OH_LOG_Print(
+    LogType /*type*/,
+    LogLevel level,
+    unsigned int /*domain*/,
+    const char* tag,
+    const char* fmt,
+    ...) {
+  std::string format = fmt;
+  std::string privacyFlag = "{public}";
+  for (auto index = format.find(privacyFlag); index != std::string::npos;
+       index = format.find(privacyFlag, index)) {
+    format.erase(index, privacyFlag.size());
+  }
+  char text[AsyncLogWriter::MAX_LINE_LENGTH + 64];
+  va_list args;
+  va_start(args, fmt);
+  std::vsnprintf(text, sizeof(text), format.c_str(), args);
+  va_end(args);
+  std::lock_guard lock(loggedLinesMtx);
+  loggedLines.push_back({level, tag, text});
+  return 0;
+}
+
+int main() {
+  return testing::runTests({
+      {"flushWritesQueuedLinesInOrder", flushWritesQueuedLinesInOrder},
+      {"rejectsLinesLongerThanASlot", rejectsLinesLongerThanASlot},
+      {"drainsWithoutFlush", drainsWithoutFlush},
+      {"keepsTheOrderOfEveryThreadAndReportsDrops",
+       keepsTheOrderOfEveryThreadAndReportsDrops},
+  });
+}
@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RNOH/BlobStore.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+constexpr size_t LARGE_BLOB_SIZE = BlobStore::MIN_MAPPED_BLOB_SIZE * 3 + 123;
+
+Bytes makeBytes(size_t size, uint8_t seed = 0) {
+  Bytes bytes(size);
+  for (size_t i = 0; i < size; i++) {
+    bytes[i] = static_cast<uint8_t>(i * 31 + seed);
+  }
+  return bytes;
+}
+
+Bytes toBytes(uint8_t const* data, size_t size) {
+  return Bytes(data, data + size);
+}
+
+Bytes toBytes(BlobStore::Blob const& blob) {
+  return toBytes(blob.data(), blob.size());
+}
+
+Bytes toBytes(std::string const& text) {
+  return toBytes(reinterpret_cast<uint8_t const*>(text.data()), text.size());
+}
+
+Bytes slice(Bytes const& bytes, size_t offset, size_t size) {
+  return Bytes(bytes.begin() + offset, bytes.begin() + offset + size);
+}
+
+/**
+ * Counts the private mappings of blob memory files of this process.
+ */
+size_t getPrivateBlobMappingsCount() {
+  std::ifstream maps("/proc/self/maps");
+  size_t count = 0;
+  for (std::string line; std::getline(maps, line);) {
+    // e.g. "7f...-7f... rw-p 00000000 00:01 1234 /memfd:rnoh_blob (deleted)"
+    auto isPrivate = line.find(" rw-p ") != std::string::npos;
+    if (isPrivate && line.find("memfd:rnoh_blob") != std::string::npos) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void savesACopy() {
+  auto& blobStore = BlobStore::getInstance();
+  auto bytes = makeBytes(100);
+  blobStore.save("save", bytes.data(), bytes.size());
+  auto savedBytes = bytes;
+  bytes[0]++;
+  auto blob = blobStore.find("save");
+  CHECK(blob.has_value());
+  CHECK(toBytes(*blob) == savedBytes);
+  blobStore.release("save");
+  CHECK(!blobStore.find("save").has_value());
+}
+
+void allocatesBlobsFilledInPlace() {
+  auto& blobStore = BlobStore::getInstance();
+  for (auto size : {size_t(0), size_t(10), LARGE_BLOB_SIZE}) {
+    auto bytes = makeBytes(size);
+    auto data = blobStore.allocate("allocate", size);
+    CHECK(data != nullptr);
+    if (size > 0) {
+      std::memcpy(data, bytes.data(), size);
+    }
+    auto blob = blobStore.find("allocate");
+    CHECK(blob.has_value() && blob->data() == data);
+    CHECK(blob.has_value() && toBytes(*blob) == bytes);
+  }
+  blobStore.release("allocate");
+}
+
+void findsClampedSlicesWithoutCopying() {
+  auto& blobStore = BlobStore::getInstance();
+  auto bytes = makeBytes(50);
+  blobStore.save("slices", bytes.data(), bytes.size());
+  auto blob = blobStore.find("slices");
+  auto middle = blobStore.find("slices", 10, 20);
+  CHECK(middle.has_value() && middle->data() == blob->data() + 10);
+  CHECK(middle.has_value() && toBytes(*middle) == slice(bytes, 10, 20));
+  CHECK(blobStore.find("slices", 40)->size() == 10);
+  CHECK(blobStore.find("slices", 40, 100)->size() == 10);
+  CHECK(blobStore.find("slices", 100)->size() == 0);
+  auto nested = middle->slice(5, 100);
+  CHECK(toBytes(nested) == slice(bytes, 15, 15));
+  CHECK(middle->slice(30).size() == 0);
+  blobStore.release("slices");
+}
+
+void keepsMemoryOfReleasedBlobsAliveWhileUsed() {
+  auto& blobStore = BlobStore::getInstance();
+  for (auto size : {size_t(64), LARGE_BLOB_SIZE}) {
+    auto bytes = makeBytes(size);
+    blobStore.save("released", bytes.data(), bytes.size());
+    auto blob = blobStore.find("released", 1);
+    auto privateCopy = blobStore.find("released")->createPrivateCopy();
+    blobStore.release("released");
+    blobStore.release("released");
+    CHECK(!blobStore.find("released").has_value());
+    CHECK(blob.has_value() && toBytes(*blob) == slice(bytes, 1, size - 1));
+    CHECK(toBytes(privateCopy.data(), privateCopy.size()) == bytes);
+  }
+}
+
+void createsBlobsFromParts() {
+  auto& blobStore = BlobStore::getInstance();
+  auto bytes = makeBytes(30);
+  blobStore.save("part", bytes.data(), bytes.size());
+
+  blobStore.createFromParts(
+      "concatenated",
+      {std::string("ab"),
+       BlobStore::BlobSlice{"part", 5, 10},
+       std::string(""),
+       BlobStore::BlobSlice{"part", 25, 100}});
+  auto expected = toBytes(std::string("ab"));
+  auto firstSlice = slice(bytes, 5, 10);
+  auto secondSlice = slice(bytes, 25, 5);
+  expected.insert(expected.end(), firstSlice.begin(), firstSlice.end());
+  expected.insert(expected.end(), secondSlice.begin(), secondSlice.end());
+  CHECK(toBytes(*blobStore.find("concatenated")) == expected);
+
+  // a blob made of a single slice shares its memory
+  blobStore.createFromParts("single", {BlobStore::BlobSlice{"part", 3, 4}});
+  CHECK(
+      blobStore.find("single")->data() == blobStore.find("part")->data() + 3);
+  CHECK(toBytes(*blobStore.find("single")) == slice(bytes, 3, 4));
+
+  blobStore.createFromParts("text", {std::string("zażółć")});
+  CHECK(toBytes(*blobStore.find("text")) == toBytes(std::string("zażółć")));
+
+  blobStore.createFromParts("empty", {});
+  CHECK(blobStore.find("empty")->size() == 0);
+
+  CHECK_THROWS(
+      blobStore.createFromParts(
+          "missingPart",
+          {std::string("a"), BlobStore::BlobSlice{"missing", 0, 1}}),
+      std::runtime_error);
+  CHECK(!blobStore.find("missingPart").has_value());
+
+  for (auto blobId : {"part", "concatenated", "single", "text", "empty"}) {
+    blobStore.release(blobId);
+  }
+}
+
+void createsPrivateCopiesWhichDontChangeTheBlob() {
+  auto& blobStore = BlobStore::getInstance();
+  for (auto size : {size_t(100), LARGE_BLOB_SIZE}) {
+    auto bytes = makeBytes(size, 7);
+    blobStore.save("private", bytes.data(), bytes.size());
+    // unaligned slices of large blobs are still mapped
+    for (auto offset : {size_t(0), size_t(1), size_t(4097), size / 2}) {
+      if (offset >= size) {
+        continue;
+      }
+      auto blob = blobStore.find("private", offset);
+      auto firstCopy = blob->createPrivateCopy();
+      auto secondCopy = blob->createPrivateCopy();
+      CHECK(firstCopy.size() == size - offset);
+      CHECK(firstCopy.data() != blob->data());
+      CHECK(
+          toBytes(firstCopy.data(), firstCopy.size()) ==
+          slice(bytes, offset, size - offset));
+      std::memset(firstCopy.data(), 0xff, firstCopy.size());
+      CHECK(toBytes(*blob) == slice(bytes, offset, size - offset));
+      CHECK(
+          toBytes(secondCopy.data(), secondCopy.size()) ==
+          slice(bytes, offset, size - offset));
+    }
+    blobStore.release("private");
+  }
+}
+
+void mapsPrivateCopiesOfLargeBlobs() {
+  auto& blobStore = BlobStore::getInstance();
+  auto bytes = makeBytes(LARGE_BLOB_SIZE);
+  blobStore.save("mapped", bytes.data(), bytes.size());
+  auto mappingsCountBefore = getPrivateBlobMappingsCount();
+  {
+    auto privateCopy = blobStore.find("mapped", 5)->createPrivateCopy();
+    CHECK(getPrivateBlobMappingsCount() == mappingsCountBefore + 1);
+    // small slices are cheaper to copy than to map
+    auto smallCopy = blobStore.find("mapped", 5, 100)->createPrivateCopy();
+    CHECK(getPrivateBlobMappingsCount() == mappingsCountBefore + 1);
+  }
+  CHECK(getPrivateBlobMappingsCount() == mappingsCountBefore);
+  blobStore.release("mapped");
+}
+
+void movesPrivateCopies() {
+  auto& blobStore = BlobStore::getInstance();
+  auto bytes = makeBytes(LARGE_BLOB_SIZE);
+  blobStore.save("moved", bytes.data(), bytes.size());
+  auto privateCopy = blobStore.find("moved")->createPrivateCopy();
+  auto data = privateCopy.data();
+  BlobStore::PrivateCopy movedCopy(std::move(privateCopy));
+  CHECK(movedCopy.data() == data && movedCopy.size() == bytes.size());
+  movedCopy = blobStore.find("moved", 0, 10)->createPrivateCopy();
+  CHECK(toBytes(movedCopy.data(), movedCopy.size()) == slice(bytes, 0, 10));
+  blobStore.release("moved");
+
+  auto emptyCopy = BlobStore::Blob().createPrivateCopy();
+  CHECK(emptyCopy.size() == 0 && emptyCopy.data() != nullptr);
+}
+
+void handlesConcurrentAccess() {
+  constexpr int THREADS_COUNT = 4;
+  constexpr int ITERATIONS_COUNT = 2000;
+  auto& blobStore = BlobStore::getInstance();
+  auto bytes = makeBytes(LARGE_BLOB_SIZE);
+  blobStore.save("shared", bytes.data(), bytes.size());
+  std::atomic<bool> isConsistent = true;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS_COUNT; t++) {
+    threads.emplace_back([&, t] {
+      auto blobId = "thread" + std::to_string(t);
+      for (int i = 0; i < ITERATIONS_COUNT; i++) {
+        blobStore.createFromParts(
+            blobId,
+            {std::to_string(i),
+             BlobStore::BlobSlice{"shared", size_t(i), 8}});
+        auto blob = blobStore.find(blobId);
+        auto expected = toBytes(std::to_string(i));
+        auto sharedSlice = slice(bytes, i, 8);
+        expected.insert(expected.end(), sharedSlice.begin(), sharedSlice.end());
+        if (!blob.has_value() || toBytes(*blob) != expected) {
+          isConsistent = false;
+        }
+        // another thread's blob may be released at any time
+        auto otherBlob =
+            blobStore.find("thread" + std::to_string((t + 1) % THREADS_COUNT));
+        if (otherBlob.has_value() && otherBlob->size() > 0) {
+          auto privateCopy = otherBlob->createPrivateCopy();
+          privateCopy.data()[0] = 0;
+        }
+        if (i % 2 == 0) {
+          blobStore.release(blobId);
+        }
+      }
+      blobStore.release(blobId);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  CHECK(isConsistent);
+  CHECK(toBytes(*blobStore.find("shared")) == bytes);
+  blobStore.release("shared");
+}
+
+} // namespace
+
+int main() {
+  return testing::runTests({
+      {"savesACopy", savesACopy},
+      {"allocatesBlobsFilledInPlace", allocatesBlobsFilledInPlace},
+      {"findsClampedSlicesWithoutCopying", findsClampedSlicesWithoutCopying},
+      {"keepsMemoryOfReleasedBlobsAliveWhileUsed",
+       keepsMemoryOfReleasedBlobsAliveWhileUsed},
+      {"createsBlobsFromParts", createsBlobsFromParts},
+      {"createsPrivateCopiesWhichDontChangeTheBlob",
+       createsPrivateCopiesWhichDontChangeTheBlob},
+      {"mapsPrivateCopiesOfLargeBlobs", mapsPrivateCopiesOfLargeBlobs},
+      {"movesPrivateCopies", movesPrivateCopies},
+      {"handlesConcurrentAccess", handlesConcurrentAccess},
+  });
+}
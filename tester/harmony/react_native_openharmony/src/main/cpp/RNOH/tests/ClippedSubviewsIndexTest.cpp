@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "RNOH/tests/Testing.h"
+#include "RNOHCorePackage/ComponentInstances/ClippedSubviewsIndex.h"
+
+using namespace rnoh;
+
+namespace {
+
+using Extent = ClippedSubviewsIndex::Extent;
+
+constexpr double ROW_HEIGHT = 48;
+constexpr double ROW_STRIDE = 52;
+
+std::vector<Extent> createRows(size_t rowsCount) {
+  std::vector<Extent> rows;
+  for (size_t i = 0; i < rowsCount; i++) {
+    rows.push_back({i * ROW_STRIDE, i * ROW_STRIDE + ROW_HEIGHT});
+  }
+  return rows;
+}
+
+// the same rule as rectIntersects, along one axis
+bool intersects(Extent extent, Extent viewport) {
+  return extent.start <= viewport.end && extent.end >= viewport.start;
+}
+
+std::vector<size_t> findVisibleChildIndicesOfAll(
+    std::vector<Extent> const& extents,
+    Extent viewport) {
+  std::vector<size_t> visibleChildIndices;
+  for (size_t i = 0; i < extents.size(); i++) {
+    if (intersects(extents[i], viewport)) {
+      visibleChildIndices.push_back(i);
+    }
+  }
+  return visibleChildIndices;
+}
+
+std::vector<size_t> applyDiff(
+    std::vector<size_t> attachedChildIndices,
+    ClippedSubviewsIndex::Diff const& diff) {
+  for (auto childIndex : diff.clippedChildIndices) {
+    attachedChildIndices.erase(std::find(
+        attachedChildIndices.begin(), attachedChildIndices.end(), childIndex));
+  }
+  for (auto const& insertion : diff.unclippedChildren) {
+    CHECK(insertion.position <= attachedChildIndices.size());
+    attachedChildIndices.insert(
+        attachedChildIndices.begin() + insertion.position,
+        insertion.childIndex);
+  }
+  return attachedChildIndices;
+}
+
+std::vector<size_t> pickRandomChildIndices(
+    std::mt19937& random,
+    size_t childrenCount) {
+  std::vector<size_t> childIndices;
+  for (size_t i = 0; i < childrenCount; i++) {
+    if (random() % 3 == 0) {
+      childIndices.push_back(i);
+    }
+  }
+  return childIndices;
+}
+
+void findsRowsInTheViewport() {
+  ClippedSubviewsIndex index;
+  index.build(createRows(100));
+  auto isVisible = [](size_t) { return true; };
+  CHECK(
+      index.findVisibleChildIndices({0, 100}, isVisible) ==
+      std::vector<size_t>({0, 1}));
+  CHECK(
+      index.findVisibleChildIndices({60, 160}, isVisible) ==
+      std::vector<size_t>({1, 2, 3}));
+  CHECK(index.findVisibleChildIndices({-200, -1}, isVisible).empty());
+  CHECK(index.findVisibleChildIndices({5200, 5400}, isVisible).empty());
+}
+
+void includesChildrenTouchingTheViewport() {
+  ClippedSubviewsIndex index;
+  index.build(createRows(10));
+  auto isVisible = [](size_t) { return true; };
+  CHECK(
+      index.findVisibleChildIndices({ROW_HEIGHT, ROW_STRIDE}, isVisible) ==
+      std::vector<size_t>({0, 1}));
+}
+
+void visitsOnlyTheChildrenInTheViewport() {
+  ClippedSubviewsIndex index;
+  index.build(createRows(1000));
+  size_t visitsCount = 0;
+  auto visibleChildIndices =
+      index.findVisibleChildIndices({26000, 26400}, [&](size_t) {
+        visitsCount++;
+        return true;
+      });
+  CHECK(visibleChildIndices.size() == 8);
+  CHECK(visitsCount == visibleChildIndices.size());
+}
+
+void skipsChildrenRejectedByTheCallback() {
+  ClippedSubviewsIndex index;
+  index.build(createRows(10));
+  auto visibleChildIndices = index.findVisibleChildIndices(
+      {0, 200}, [](size_t childIndex) { return childIndex % 2 == 1; });
+  CHECK(visibleChildIndices == std::vector<size_t>({1, 3}));
+}
+
+void findsUnsortedAndOverlappingChildren() {
+  std::mt19937 random(1);
+  std::uniform_real_distribution<double> startDistribution(-100, 5000);
+  std::uniform_real_distribution<double> lengthDistribution(0, 300);
+  for (int round = 0; round < 200; round++) {
+    std::vector<Extent> extents(random() % 50);
+    for (auto& extent : extents) {
+      extent.start = startDistribution(random);
+      // some children span a large part of the content
+      extent.end = extent.start +
+          lengthDistribution(random) * (random() % 10 == 0 ? 10 : 1);
+    }
+    ClippedSubviewsIndex index;
+    index.build(extents);
+    for (int query = 0; query < 20; query++) {
+      auto viewportStart = startDistribution(random);
+      Extent viewport{viewportStart, viewportStart + 400};
+      CHECK(
+          index.findVisibleChildIndices(
+              viewport, [](size_t) { return true; }) ==
+          findVisibleChildIndicesOfAll(extents, viewport));
+    }
+  }
+}
+
+void diffTurnsTheAttachedChildrenIntoTheVisibleOnes() {
+  std::mt19937 random(2);
+  for (int round = 0; round < 500; round++) {
+    auto childrenCount = random() % 40;
+    auto previousVisibleChildIndices =
+        pickRandomChildIndices(random, childrenCount);
+    auto visibleChildIndices = pickRandomChildIndices(random, childrenCount);
+    auto diff = ClippedSubviewsIndex::diff(
+        previousVisibleChildIndices, visibleChildIndices);
+    CHECK(
+        applyDiff(previousVisibleChildIndices, diff) == visibleChildIndices);
+  }
+}
+
+void diffIsEmptyWhenNothingChanges() {
+  std::vector<size_t> visibleChildIndices{2, 3, 4};
+  auto diff =
+      ClippedSubviewsIndex::diff(visibleChildIndices, visibleChildIndices);
+  CHECK(diff.clippedChildIndices.empty());
+  CHECK(diff.unclippedChildren.empty());
+}
+
+void scrollingStepByStepKeepsTheVisibleRowsAttached() {
+  auto rows = createRows(300);
+  ClippedSubviewsIndex index;
+  index.build(rows);
+  std::vector<size_t> attachedChildIndices;
+  for (double offset = 0; offset < 15000; offset += 37) {
+    Extent viewport{offset, offset + 400};
+    auto visibleChildIndices =
+        index.findVisibleChildIndices(viewport, [](size_t) { return true; });
+    attachedChildIndices = applyDiff(
+        attachedChildIndices,
+        ClippedSubviewsIndex::diff(attachedChildIndices, visibleChildIndices));
+    CHECK(attachedChildIndices == findVisibleChildIndicesOfAll(rows, viewport));
+  }
+}
+
+} // namespace
+
+int main() {
+  return testing::runTests({
+      {"findsRowsInTheViewport", findsRowsInTheViewport},
+      {"includesChildrenTouchingTheViewport",
+       includesChildrenTouchingTheViewport},
+      {"visitsOnlyTheChildrenInTheViewport",
+       visitsOnlyTheChildrenInTheViewport},
+      {"skipsChildrenRejectedByTheCallback",
+       skipsChildrenRejectedByTheCallback},
+      {"findsUnsortedAndOverlappingChildren",
+       findsUnsortedAndOverlappingChildren},
+      {"diffTurnsTheAttachedChildrenIntoTheVisibleOnes",
+       diffTurnsTheAttachedChildrenIntoTheVisibleOnes},
+      {"diffIsEmptyWhenNothingChanges", diffIsEmptyWhenNothingChanges},
+      {"scrollingStepByStepKeepsTheVisibleRowsAttached",
+       scrollingStepByStepKeepsTheVisibleRowsAttached},
+  });
+}
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+/**
+ * Compares evaluating the typed ranges InterpolationAnimatedNode parses once
+ * ("now") with what the node did on every frame before: a linear scan of the
+ * input range and, for string outputs, parsing both outputs with std::regex.
+ * Prints the average time of an evaluation for each output type. Color
+ * outputs aren't covered, as rnoh::Color depends on the React headers.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <regex>
+#include <string>
+#include <vector>
+#include "RNOHCorePackage/TurboModules/Animated/Nodes/Interpolation.h"
+
+using namespace rnoh::interpolation;
+
+namespace {
+
+struct Config {
+  size_t stopsCount;
+  size_t evaluationsCount;
+};
+
+// keeps the compiler from dropping the evaluated results
+volatile size_t sink;
+
+std::vector<double> makeInputRange(size_t stopsCount) {
+  std::vector<double> inputRange;
+  for (size_t i = 0; i < stopsCount; i++) {
+    inputRange.push_back(static_cast<double>(i));
+  }
+  return inputRange;
+}
+
+std::vector<std::string> makeStringOutputRange(size_t stopsCount) {
+  std::vector<std::string> outputRange;
+  for (size_t i = 0; i < stopsCount; i++) {
+    outputRange.push_back(
+        "rotate(" + std::to_string(i * 36) + "deg) scale(" +
+        std::to_string(1 + i * 0.1) + ")");
+  }
+  return outputRange;
+}
+
+double getValue(size_t evaluation, size_t stopsCount) {
+  return static_cast<double>(evaluation % (stopsCount * 10)) / 10;
+}
+
+size_t findRangeIndexLinearly(
+    std::vector<double> const& inputRange,
+    double value) {
+  size_t index = 1;
+  while (index < inputRange.size() - 1 && inputRange[index] < value) {
+    index++;
+  }
+  return index - 1;
+}
+
+std::vector<double> parseNumericValues(
+    std::regex const& regex,
+    std::string const& str) {
+  std::vector<double> values;
+  for (auto it = std::sregex_iterator(str.begin(), str.end(), regex);
+       it != std::sregex_iterator();
+       ++it) {
+    values.push_back(std::stod(it->str()));
+  }
+  return values;
+}
+
+std::string interpolateStringWithRegex(
+    std::string const& start,
+    std::string const& end,
+    double ratio) {
+  std::regex regex("([-+]?[0-9]*\\.?[0-9]+)");
+  auto startValues = parseNumericValues(regex, start);
+  auto endValues = parseNumericValues(regex, end);
+  std::string result;
+  size_t literalBegin = 0;
+  size_t index = 0;
+  for (auto it = std::sregex_iterator(start.begin(), start.end(), regex);
+       it != std::sregex_iterator();
+       ++it) {
+    result.append(start, literalBegin, it->position() - literalBegin);
+    result += std::to_string(
+        startValues[index] + ratio * (endValues[index] - startValues[index]));
+    literalBegin = it->position() + it->length();
+    index++;
+  }
+  result.append(start, literalBegin);
+  return result;
+}
+
+double toNsPerEvaluation(
+    std::chrono::steady_clock::duration duration,
+    size_t evaluationsCount) {
+  return std::chrono::duration<double, std::nano>(duration).count() /
+      evaluationsCount;
+}
+
+double benchmarkNumbersScanningLinearly(Config const& config) {
+  auto inputRange = makeInputRange(config.stopsCount);
+  auto outputRange = makeInputRange(config.stopsCount);
+  size_t checksum = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < config.evaluationsCount; i++) {
+    auto value = getValue(i, config.stopsCount);
+    auto rangeIndex = findRangeIndexLinearly(inputRange, value);
+    checksum += static_cast<size_t>(interpolate(
+        value,
+        inputRange[rangeIndex],
+        inputRange[rangeIndex + 1],
+        outputRange[rangeIndex],
+        outputRange[rangeIndex + 1],
+        EXTRAPOLATE_TYPE_CLAMP,
+        EXTRAPOLATE_TYPE_CLAMP));
+  }
+  auto duration = std::chrono::steady_clock::now() - startTime;
+  sink = checksum;
+  return toNsPerEvaluation(duration, config.evaluationsCount);
+}
+
+double benchmarkNumbers(Config const& config) {
+  auto inputRange = makeInputRange(config.stopsCount);
+  auto outputRange = makeInputRange(config.stopsCount);
+  size_t checksum = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < config.evaluationsCount; i++) {
+    auto value = getValue(i, config.stopsCount);
+    auto rangeIndex = findRangeIndex(inputRange, value);
+    checksum += static_cast<size_t>(interpolate(
+        value,
+        inputRange[rangeIndex],
+        inputRange[rangeIndex + 1],
+        outputRange[rangeIndex],
+        outputRange[rangeIndex + 1],
+        EXTRAPOLATE_TYPE_CLAMP,
+        EXTRAPOLATE_TYPE_CLAMP));
+  }
+  auto duration = std::chrono::steady_clock::now() - startTime;
+  sink = checksum;
+  return toNsPerEvaluation(duration, config.evaluationsCount);
+}
+
+double benchmarkStringsWithRegex(Config const& config) {
+  auto inputRange = makeInputRange(config.stopsCount);
+  auto outputRange = makeStringOutputRange(config.stopsCount);
+  size_t checksum = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < config.evaluationsCount; i++) {
+    auto value = getValue(i, config.stopsCount);
+    auto rangeIndex = findRangeIndexLinearly(inputRange, value);
+    auto ratio = (value - inputRange[rangeIndex]) /
+        (inputRange[rangeIndex + 1] - inputRange[rangeIndex]);
+    checksum += interpolateStringWithRegex(
+                    outputRange[rangeIndex], outputRange[rangeIndex + 1], ratio)
+                    .size();
+  }
+  auto duration = std::chrono::steady_clock::now() - startTime;
+  sink = checksum;
+  return toNsPerEvaluation(duration, config.evaluationsCount);
+}
+
+double benchmarkStrings(Config const& config) {
+  auto inputRange = makeInputRange(config.stopsCount);
+  std::vector<StringOutput> outputRange;
+  for (auto const& output : makeStringOutputRange(config.stopsCount)) {
+    outputRange.push_back(StringOutput::parse(output));
+  }
+  size_t checksum = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < config.evaluationsCount; i++) {
+    auto value = getValue(i, config.stopsCount);
+    auto rangeIndex = findRangeIndex(inputRange, value);
+    auto ratio = (value - inputRange[rangeIndex]) /
+        (inputRange[rangeIndex + 1] - inputRange[rangeIndex]);
+    checksum += interpolateString(
+                    outputRange[rangeIndex], outputRange[rangeIndex + 1], ratio)
+                    .size();
+  }
+  auto duration = std::chrono::steady_clock::now() - startTime;
+  sink = checksum;
+  return toNsPerEvaluation(duration, config.evaluationsCount);
+}
+
+using Benchmark = double (*)(Config const&);
+
+void report(
+    char const* workload,
+    Benchmark previousBenchmark,
+    Benchmark currentBenchmark,
+    Config const& config) {
+  std::printf(
+      "%-14s %4zu stops   before %9.1f ns/op   now %9.1f ns/op\n",
+      workload,
+      config.stopsCount,
+      previousBenchmark(config),
+      currentBenchmark(config));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  bool isQuick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+  size_t evaluationsCount = isQuick ? 1000 : 1000000;
+  for (size_t stopsCount : {size_t(2), size_t(10), size_t(100)}) {
+    Config config{stopsCount, evaluationsCount};
+    report(
+        "number output",
+        benchmarkNumbersScanningLinearly,
+        benchmarkNumbers,
+        config);
+  }
+  for (size_t stopsCount : {size_t(2), size_t(10)}) {
+    Config config{
+        stopsCount, isQuick ? evaluationsCount : evaluationsCount / 10};
+    report(
+        "string output", benchmarkStringsWithRegex, benchmarkStrings, config);
+  }
+  return 0;
+}
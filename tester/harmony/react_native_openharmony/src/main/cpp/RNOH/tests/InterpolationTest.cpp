@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <cmath>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "RNOH/tests/Testing.h"
+#include "RNOHCorePackage/TurboModules/Animated/Nodes/Interpolation.h"
+
+using namespace rnoh::interpolation;
+
+namespace {
+
+// std::regex based reference, like the implementation
+// InterpolationAnimatedNode used before parsing its ranges once (which
+// replaced the numbers from the front, shifting the positions of later
+// matches when the lengths differed)
+std::string interpolateStringWithRegex(
+    std::string const& start,
+    std::string const& end,
+    double ratio) {
+  std::regex regex("([-+]?[0-9]*\\.?[0-9]+)");
+  std::vector<double> endValues;
+  for (auto it = std::sregex_iterator(end.begin(), end.end(), regex);
+       it != std::sregex_iterator();
+       ++it) {
+    endValues.push_back(std::stod(it->str()));
+  }
+  std::string result = start;
+  size_t index = 0;
+  // replacing from the back keeps the positions of earlier matches valid
+  std::vector<std::smatch> matches;
+  for (auto it = std::sregex_iterator(start.begin(), start.end(), regex);
+       it != std::sregex_iterator();
+       ++it) {
+    matches.push_back(*it);
+  }
+  std::vector<std::string> replacements;
+  for (auto const& match : matches) {
+    auto startValue = std::stod(match.str());
+    auto endValue = index < endValues.size() ? endValues[index] : startValue;
+    replacements.push_back(
+        std::to_string(startValue + ratio * (endValue - startValue)));
+    index++;
+  }
+  for (size_t i = matches.size(); i > 0; i--) {
+    auto const& match = matches[i - 1];
+    result.replace(match.position(), match.length(), replacements[i - 1]);
+  }
+  return result;
+}
+
+void splitsStringsAroundNumbers() {
+  auto output = StringOutput::parse("rotate(45deg)");
+  CHECK((output.literals == std::vector<std::string>{"rotate(", "deg)"}));
+  CHECK((output.values == std::vector<double>{45}));
+  CHECK(output.literalsLength == 11);
+
+  auto plain = StringOutput::parse("none");
+  CHECK((plain.literals == std::vector<std::string>{"none"}));
+  CHECK(plain.values.empty());
+}
+
+void parsesSignsAndFractions() {
+  auto output = StringOutput::parse("-1.5px +2 .25 3.");
+  CHECK((output.values == std::vector<double>{-1.5, 2, 0.25, 3}));
+  CHECK((output.literals ==
+         std::vector<std::string>{"", "px ", " ", " ", "."}));
+}
+
+void interpolatesStringsLikeTheRegexImplementation() {
+  std::vector<std::pair<std::string, std::string>> ranges = {
+      {"0deg", "360deg"},
+      {"rotate(-45.5deg)", "rotate(90deg)"},
+      {"rgba(0, 0, 255, 1)", "rgba(255, 128, 0, 0.5)"},
+      {"1px 2px", "3px"},
+      {"matrix(1, 0, 0, 1, .5, -2)", "matrix(2, 0, 0, 2, 10, 20)"},
+      {"none", "none"},
+  };
+  for (auto const& [start, end] : ranges) {
+    auto startOutput = StringOutput::parse(start);
+    auto endOutput = StringOutput::parse(end);
+    for (double ratio : {0.0, 0.25, 0.5, 1.0, 1.5, -0.5}) {
+      CHECK(
+          interpolateString(startOutput, endOutput, ratio) ==
+          interpolateStringWithRegex(start, end, ratio));
+    }
+  }
+}
+
+void findsTheRangeOfAValue() {
+  std::vector<double> inputRange = {0, 10, 20, 30};
+  CHECK(findRangeIndex(inputRange, -5) == 0);
+  CHECK(findRangeIndex(inputRange, 0) == 0);
+  CHECK(findRangeIndex(inputRange, 10) == 0);
+  CHECK(findRangeIndex(inputRange, 10.5) == 1);
+  CHECK(findRangeIndex(inputRange, 25) == 2);
+  CHECK(findRangeIndex(inputRange, 100) == 2);
+  CHECK(findRangeIndex({0, 1}, 5) == 0);
+}
+
+void findsTheSameRangeAsALinearScan() {
+  std::vector<double> inputRange = {-10, -10, 0, 1, 1, 1, 5, 100};
+  for (double value = -20; value <= 110; value += 0.5) {
+    size_t index = 1;
+    while (index < inputRange.size() - 1 && inputRange[index] < value) {
+      index++;
+    }
+    CHECK(findRangeIndex(inputRange, value) == index - 1);
+  }
+}
+
+void extrapolatesNumbers() {
+  auto interpolateWith = [](double value, ExtrapolateType type) {
+    return interpolate(value, 0, 10, 100, 200, type, type);
+  };
+  CHECK(interpolateWith(5, EXTRAPOLATE_TYPE_CLAMP) == 150);
+  CHECK(interpolateWith(-5, EXTRAPOLATE_TYPE_CLAMP) == 100);
+  CHECK(interpolateWith(20, EXTRAPOLATE_TYPE_CLAMP) == 200);
+  CHECK(interpolateWith(-5, EXTRAPOLATE_TYPE_EXTEND) == 50);
+  CHECK(interpolateWith(20, EXTRAPOLATE_TYPE_EXTEND) == 300);
+  CHECK(interpolateWith(-5, EXTRAPOLATE_TYPE_IDENTITY) == -5);
+  CHECK(interpolateWith(20, EXTRAPOLATE_TYPE_IDENTITY) == 20);
+  CHECK(
+      interpolate(
+          5, 5, 5, 0, 1, EXTRAPOLATE_TYPE_EXTEND, EXTRAPOLATE_TYPE_EXTEND) ==
+      1);
+}
+
+void parsesExtrapolateTypes() {
+  CHECK(extrapolateTypeFromString("identity") == EXTRAPOLATE_TYPE_IDENTITY);
+  CHECK(extrapolateTypeFromString("clamp") == EXTRAPOLATE_TYPE_CLAMP);
+  CHECK(extrapolateTypeFromString("extend") == EXTRAPOLATE_TYPE_EXTEND);
+  CHECK_THROWS(extrapolateTypeFromString("wrap"), std::runtime_error);
+}
+
+} // namespace
+
+int main() {
+  return rnoh::testing::runTests({
+      {"splitsStringsAroundNumbers", splitsStringsAroundNumbers},
+      {"parsesSignsAndFractions", parsesSignsAndFractions},
+      {"interpolatesStringsLikeTheRegexImplementation",
+       interpolatesStringsLikeTheRegexImplementation},
+      {"findsTheRangeOfAValue", findsTheRangeOfAValue},
+      {"findsTheSameRangeAsALinearScan", findsTheSameRangeAsALinearScan},
+      {"extrapolatesNumbers", extrapolatesNumbers},
+      {"parsesExtrapolateTypes", parsesExtrapolateTypes},
+  });
+}
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "RNOH/JSBigStringHelpers.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+
+/**
+ * Rawfiles are regions of a single archive file, like rawfiles in a HAP.
+ */
+struct NativeResourceManager {
+  std::string archivePath;
+  std::unordered_map<std::string, std::pair<long, long>> regionByName;
+};
+
+struct RawFile {
+  NativeResourceManager const* resourceManager;
+  std::pair<long, long> region;
+};
+
+namespace {
+
+namespace fs = std::filesystem;
+
+int openRawFilesCount = 0;
+int openDescriptorsCount = 0;
+
+size_t const PAGE_SIZE = sysconf(_SC_PAGESIZE);
+
+std::string const& getTestDir() {
+  static std::string const testDir = [] {
+    char dirTemplate[] = "/tmp/JSBigStringHelpersTest.XXXXXX";
+    return std::string(mkdtemp(dirTemplate));
+  }();
+  return testDir;
+}
+
+std::string makeSource(size_t size) {
+  std::string source(size, '\0');
+  for (size_t i = 0; i < size; i++) {
+    source[i] = static_cast<char>('a' + i % 26);
+  }
+  return source;
+}
+
+std::string writeFile(std::string const& name, std::string const& contents) {
+  auto path = getTestDir() + "/" + name;
+  std::ofstream file(path, std::ios::binary);
+  file << contents;
+  return path;
+}
+
+std::string readFile(std::string const& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::string(
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool holds(
+    std::unique_ptr<facebook::react::JSBigString const> const& string,
+    std::string const& expected) {
+  return string != nullptr && string->size() == expected.size() &&
+      std::memcmp(string->c_str(), expected.data(), expected.size()) == 0 &&
+      string->c_str()[expected.size()] == '\0';
+}
+
+/**
+ * Sizes around page boundaries, where the terminator either fits in the
+ * last page of the mapping or lands in the guard page behind it.
+ */
+std::vector<size_t> getSizes() {
+  return {
+      0,
+      1,
+      5,
+      PAGE_SIZE - 1,
+      PAGE_SIZE,
+      PAGE_SIZE + 1,
+      3 * PAGE_SIZE,
+      3 * PAGE_SIZE + 7};
+}
+
+void copiesBuffersIntoNullTerminatedStrings() {
+  for (auto size : getSizes()) {
+    auto source = makeSource(size);
+    auto expected = source;
+    auto string = JSBigStringHelpers::fromBuffer(
+        reinterpret_cast<uint8_t const*>(source.data()), source.size());
+    source.assign(size, 'x');
+    CHECK(holds(string, expected));
+  }
+}
+
+void mapsFilesWithATerminator() {
+  for (auto size : getSizes()) {
+    auto source = makeSource(size);
+    auto path = writeFile("bundle" + std::to_string(size) + ".js", source);
+    auto string = JSBigStringHelpers::fromFilePath(path);
+    CHECK(holds(string, source));
+    // the terminator is written to a private copy
+    CHECK(readFile(path) == source);
+  }
+}
+
+void mapsRawFileRegions() {
+  auto archive = makeSource(5 * PAGE_SIZE);
+  NativeResourceManager resourceManager{writeFile("archive.hap", archive), {}};
+  std::vector<std::pair<long, long>> regions;
+  for (long offset : {0L, 1L, long(PAGE_SIZE) - 3, long(PAGE_SIZE), 4097L}) {
+    for (auto size : getSizes()) {
+      if (offset + size <= archive.size()) {
+        regions.emplace_back(offset, size);
+      }
+    }
+  }
+  // a region which ends with the archive
+  regions.emplace_back(PAGE_SIZE + 10, archive.size() - PAGE_SIZE - 10);
+  for (auto [offset, size] : regions) {
+    auto name = "bundle" + std::to_string(offset) + "_" + std::to_string(size);
+    resourceManager.regionByName[name] = {offset, size};
+    auto string = JSBigStringHelpers::fromRawFilePath(name, &resourceManager);
+    CHECK(holds(string, archive.substr(offset, size)));
+  }
+  CHECK(readFile(resourceManager.archivePath) == archive);
+  CHECK(openRawFilesCount == 0);
+  CHECK(openDescriptorsCount == 0);
+}
+
+void throwsForMissingFiles() {
+  CHECK_THROWS(
+      JSBigStringHelpers::fromFilePath(getTestDir() + "/missing.js"),
+      std::runtime_error);
+  NativeResourceManager resourceManager{getTestDir() + "/missing.hap", {}};
+  CHECK_THROWS(
+      JSBigStringHelpers::fromRawFilePath("missing.js", &resourceManager),
+      std::runtime_error);
+  // the rawfile exists, but its descriptor can't be opened
+  resourceManager.regionByName["bundle.js"] = {0, 10};
+  CHECK_THROWS(
+      JSBigStringHelpers::fromRawFilePath("bundle.js", &resourceManager),
+      std::runtime_error);
+  CHECK(openRawFilesCount == 0);
+  CHECK(openDescriptorsCount == 0);
+}
+
+} // namespace
+
+extern "C" RawFile* OH_ResourceManager_OpenRawFile(
+    const NativeResourceManager* mgr,
+    const char* fileName) {
+  auto it = mgr->regionByName.find(fileName);
+  if (it == mgr->regionByName.end()) {
+    return nullptr;
+  }
+  openRawFilesCount++;
+  return new RawFile{mgr, it->second};
+}
+
+extern "C" void OH_ResourceManager_CloseRawFile(RawFile* rawFile) {
+  openRawFilesCount--;
+  delete rawFile;
+}
+
+extern "C" bool OH_ResourceManager_GetRawFileDescriptorData(
+    const RawFile* rawFile,
+    RawFileDescriptor* descriptor) {
+  auto fd = open(
+      rawFile->resourceManager->archivePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  openDescriptorsCount++;
+  *descriptor = {fd, rawFile->region.first, rawFile->region.second};
+  return true;
+}
+
+extern "C" bool OH_ResourceManager_ReleaseRawFileDescriptorData(
+    const RawFileDescriptor* descriptor) {
+  openDescriptorsCount--;
+  return close(descriptor->fd) == 0;
+}
+
+int main() {
+  auto result = testing::runTests({
+      {"copiesBuffersIntoNullTerminatedStrings",
+       copiesBuffersIntoNullTerminatedStrings},
+      {"mapsFilesWithATerminator", mapsFilesWithATerminator},
+      {"mapsRawFileRegions", mapsRawFileRegions},
+      {"throwsForMissingFiles", throwsForMissingFiles},
+  });
+  fs::remove_all(getTestDir());
+  return result;
+}
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <stdlib.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "JSVMCodeCache.h"
+#include "RNOH/Performance/HarmonyReactMarker.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+using rnjsvm::JSVMCodeCache;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+using Bytes = std::vector<uint8_t>;
+using MarkerId = HarmonyReactMarker::HarmonyReactMarkerId;
+
+constexpr uint64_t BUNDLE_HASH = 0x1234;
+constexpr uint32_t ENGINE_VERSION_TAG = 42;
+
+std::vector<std::pair<MarkerId, std::string>> loggedMarkers;
+
+std::string const& getTestDir() {
+  static std::string const testDir = [] {
+    char dirTemplate[] = "/tmp/JSVMCodeCacheTest.XXXXXX";
+    return std::string(mkdtemp(dirTemplate));
+  }();
+  return testDir;
+}
+
+std::string getCachePath(std::string const& name) {
+  return getTestDir() + "/caches/" + name + ".cache";
+}
+
+Bytes makeBytes(size_t size, uint8_t seed = 0) {
+  Bytes bytes(size);
+  for (size_t i = 0; i < size; i++) {
+    bytes[i] = static_cast<uint8_t>(i * 13 + seed);
+  }
+  return bytes;
+}
+
+Bytes toBytes(JSVMCodeCache::Shared const& cache) {
+  return Bytes(cache->data(), cache->data() + cache->size());
+}
+
+Bytes readFile(std::string const& path) {
+  std::ifstream file(path, std::ios::binary);
+  return Bytes(
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * Replaces the file instead of writing to it, since caches are read-only.
+ */
+void replaceFile(std::string const& path, Bytes const& bytes) {
+  fs::remove(path);
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+}
+
+/**
+ * Writes a valid cache and then replaces it with `corrupt(contents)`, at a
+ * path that wasn't looked up before.
+ */
+template <typename Corrupt>
+std::string writeCorruptCache(std::string const& name, Corrupt corrupt) {
+  auto path = getCachePath(name);
+  auto bytes = makeBytes(1000);
+  JSVMCodeCache::update(
+      path, BUNDLE_HASH, ENGINE_VERSION_TAG, bytes.data(), bytes.size());
+  auto contents = readFile(path);
+  corrupt(contents);
+  replaceFile(path, contents);
+  return path;
+}
+
+void missesWhenThereIsNoCache() {
+  auto path = getCachePath("missing");
+  CHECK(JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG) == nullptr);
+}
+
+void hitsAfterUpdate() {
+  // in its own directory, which is created by the update
+  auto path = getTestDir() + "/hit/hit.cache";
+  auto bytes = makeBytes(100000);
+  JSVMCodeCache::update(
+      path, BUNDLE_HASH, ENGINE_VERSION_TAG, bytes.data(), bytes.size());
+  CHECK(fs::file_size(path) > bytes.size());
+  auto cache = JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG);
+  CHECK(cache != nullptr && toBytes(cache) == bytes);
+  // the second lookup doesn't map the file again
+  auto sameCache = JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG);
+  CHECK(sameCache == cache);
+  CHECK(sameCache != nullptr && sameCache->data() == cache->data());
+  // no temporary files are left behind
+  auto dir = fs::path(path).parent_path();
+  CHECK(std::distance(fs::directory_iterator(dir), {}) == 1);
+}
+
+void remapsUpdatedCaches() {
+  auto path = getCachePath("updated");
+  auto bytes = makeBytes(5000, 1);
+  JSVMCodeCache::update(
+      path, BUNDLE_HASH, ENGINE_VERSION_TAG, bytes.data(), bytes.size());
+  auto cache = JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG);
+  auto updatedBytes = makeBytes(7000, 2);
+  JSVMCodeCache::update(
+      path,
+      BUNDLE_HASH,
+      ENGINE_VERSION_TAG,
+      updatedBytes.data(),
+      updatedBytes.size());
+  auto updatedCache = JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG);
+  CHECK(updatedCache != nullptr && toBytes(updatedCache) == updatedBytes);
+  // caches in use stay valid
+  CHECK(cache != nullptr && toBytes(cache) == bytes);
+}
+
+void rejectsStaleCaches() {
+  auto path = getCachePath("stale");
+  auto bytes = makeBytes(100);
+  JSVMCodeCache::update(
+      path, BUNDLE_HASH, ENGINE_VERSION_TAG, bytes.data(), bytes.size());
+  CHECK(JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG) != nullptr);
+  // both with and without a mapping of the cache in memory
+  for (int i = 0; i < 2; i++) {
+    CHECK(
+        JSVMCodeCache::get(path, BUNDLE_HASH + 1, ENGINE_VERSION_TAG) ==
+        nullptr);
+    CHECK(
+        JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG + 1) ==
+        nullptr);
+  }
+  CHECK(JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG) != nullptr);
+}
+
+void rejectsCorruptCaches() {
+  auto badChecksumPath =
+      writeCorruptCache("badChecksum", [](Bytes& contents) {
+        contents.back() ^= 1;
+      });
+  auto truncatedPath = writeCorruptCache(
+      "truncated", [](Bytes& contents) { contents.pop_back(); });
+  auto extendedPath = writeCorruptCache(
+      "extended", [](Bytes& contents) { contents.push_back(0); });
+  auto badMagicPath = writeCorruptCache(
+      "badMagic", [](Bytes& contents) { contents.front() ^= 1; });
+  auto headerOnlyPath = writeCorruptCache(
+      "headerOnly", [](Bytes& contents) { contents.resize(40); });
+  auto emptyPath =
+      writeCorruptCache("empty", [](Bytes& contents) { contents.clear(); });
+  for (auto const& path :
+       {badChecksumPath,
+        truncatedPath,
+        extendedPath,
+        badMagicPath,
+        headerOnlyPath,
+        emptyPath}) {
+    CHECK(
+        JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG) == nullptr);
+  }
+}
+
+void reportsLookupsThroughMarkers() {
+  auto path = getCachePath("markers");
+  auto bytes = makeBytes(321);
+  JSVMCodeCache::update(
+      path, BUNDLE_HASH, ENGINE_VERSION_TAG, bytes.data(), bytes.size());
+  loggedMarkers.clear();
+  JSVMCodeCache::get(path, BUNDLE_HASH, ENGINE_VERSION_TAG);
+  JSVMCodeCache::get(getCachePath("missing"), BUNDLE_HASH, ENGINE_VERSION_TAG);
+  std::vector<std::pair<MarkerId, std::string>> expectedMarkers{
+      {MarkerId::JSVM_CODE_CACHE_LOOKUP_START, path},
+      {MarkerId::JSVM_CODE_CACHE_LOOKUP_STOP, path},
+      {MarkerId::JSVM_CODE_CACHE_SIZE, "321"},
+      {MarkerId::JSVM_CODE_CACHE_LOOKUP_START, getCachePath("missing")},
+      {MarkerId::JSVM_CODE_CACHE_LOOKUP_STOP, getCachePath("missing")},
+      {MarkerId::JSVM_CODE_CACHE_SIZE, "0"},
+  };
+  CHECK(loggedMarkers == expectedMarkers);
+}
+
+void hashesEveryByte() {
+  auto bytes = makeBytes(40);
+  // sizes which do and don't end on a word boundary
+  for (size_t size = 0; size <= bytes.size(); size++) {
+    auto hash = JSVMCodeCache::hash(bytes.data(), size);
+    CHECK(hash == JSVMCodeCache::hash(bytes.data(), size));
+    for (size_t i = 0; i < size; i++) {
+      auto changedBytes = bytes;
+      changedBytes[i] ^= 0x80;
+      CHECK(JSVMCodeCache::hash(changedBytes.data(), size) != hash);
+    }
+    if (size > 0) {
+      CHECK(JSVMCodeCache::hash(bytes.data(), size - 1) != hash);
+    }
+  }
+}
+
+} // namespace
+
+void HarmonyReactMarker::logMarker(
+    const HarmonyReactMarkerId markerId,
+    const char* tag) {
+  loggedMarkers.emplace_back(markerId, tag);
+}
+
+int main() {
+  auto result = testing::runTests({
+      {"missesWhenThereIsNoCache", missesWhenThereIsNoCache},
+      {"hitsAfterUpdate", hitsAfterUpdate},
+      {"remapsUpdatedCaches", remapsUpdatedCaches},
+      {"rejectsStaleCaches", rejectsStaleCaches},
+      {"rejectsCorruptCaches", rejectsCorruptCaches},
+      {"reportsLookupsThroughMarkers", reportsLookupsThroughMarkers},
+      {"hashesEveryByte", hashesEveryByte},
+  });
+  fs::remove_all(getTestDir());
+  return result;
+}
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+/**
+ * Compares PagedTagMap, which backs ComponentInstanceRegistry, with the
+ * mutex-guarded std::unordered_map the registry used before. Prints the
+ * average time of an operation for each workload.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "RNOH/PagedTagMap.h"
+
+using namespace rnoh;
+
+namespace {
+
+using Tag = int32_t;
+
+struct Value {
+  Tag tag;
+};
+
+class LockedUnorderedMap {
+ public:
+  std::shared_ptr<Value> find(Tag tag) const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto it = m_valueByTag.find(tag);
+    if (it != m_valueByTag.end()) {
+      return it->second;
+    }
+    return nullptr;
+  }
+
+  bool insert(Tag tag, std::shared_ptr<Value> value) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_valueByTag.emplace(tag, std::move(value)).second;
+  }
+
+  std::shared_ptr<Value> erase(Tag tag) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto it = m_valueByTag.find(tag);
+    if (it == m_valueByTag.end()) {
+      return nullptr;
+    }
+    auto value = std::move(it->second);
+    m_valueByTag.erase(it);
+    return value;
+  }
+
+ private:
+  mutable std::mutex m_mtx;
+  std::unordered_map<Tag, std::shared_ptr<Value>> m_valueByTag;
+};
+
+struct Config {
+  size_t tagsCount;
+  size_t lookupsCount;
+  size_t readerThreadsCount;
+};
+
+// Fabric allocates tags in steps of 2 (odd tags for views, even for roots)
+Tag getTag(size_t index) {
+  return static_cast<Tag>(index * 2 + 1);
+}
+
+double toNsPerOperation(
+    std::chrono::steady_clock::duration duration,
+    size_t operationsCount) {
+  return std::chrono::duration<double, std::nano>(duration).count() /
+      operationsCount;
+}
+
+template <typename Map>
+void fill(Map& map, size_t tagsCount) {
+  for (size_t i = 0; i < tagsCount; i++) {
+    map.insert(getTag(i), std::make_shared<Value>(Value{getTag(i)}));
+  }
+}
+
+template <typename Map>
+double benchmarkInsertAndErase(Config const& config) {
+  Map map;
+  auto startTime = std::chrono::steady_clock::now();
+  fill(map, config.tagsCount);
+  for (size_t i = 0; i < config.tagsCount; i++) {
+    map.erase(getTag(i));
+  }
+  return toNsPerOperation(
+      std::chrono::steady_clock::now() - startTime, config.tagsCount * 2);
+}
+
+template <typename Map>
+size_t lookUpRandomTags(Map const& map, Config const& config, unsigned seed) {
+  std::mt19937 random(seed);
+  std::uniform_int_distribution<size_t> indexDistribution(
+      0, config.tagsCount - 1);
+  size_t foundCount = 0;
+  for (size_t i = 0; i < config.lookupsCount; i++) {
+    if (map.find(getTag(indexDistribution(random))) != nullptr) {
+      foundCount++;
+    }
+  }
+  return foundCount;
+}
+
+template <typename Map>
+double benchmarkLookupsOnOwnerThread(Config const& config) {
+  Map map;
+  fill(map, config.tagsCount);
+  auto startTime = std::chrono::steady_clock::now();
+  auto foundCount = lookUpRandomTags(map, config, 1);
+  auto duration = std::chrono::steady_clock::now() - startTime;
+  if (foundCount != config.lookupsCount) {
+    std::fprintf(stderr, "unexpected lookup misses\n");
+  }
+  return toNsPerOperation(duration, config.lookupsCount);
+}
+
+template <typename Map>
+double benchmarkLookupsOnReaderThreads(Config const& config) {
+  Map map;
+  fill(map, config.tagsCount);
+  std::vector<std::thread> readers;
+  auto startTime = std::chrono::steady_clock::now();
+  for (size_t r = 0; r < config.readerThreadsCount; r++) {
+    readers.emplace_back([&map, &config, r] {
+      lookUpRandomTags(map, config, static_cast<unsigned>(r + 1));
+    });
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  return toNsPerOperation(
+      std::chrono::steady_clock::now() - startTime,
+      config.lookupsCount * config.readerThreadsCount);
+}
+
+using Benchmark = double (*)(Config const&);
+
+void report(
+    char const* workload,
+    Benchmark lockedMapBenchmark,
+    Benchmark pagedMapBenchmark,
+    Config const& config) {
+  std::printf(
+      "%-26s unordered_map+mutex %8.1f ns/op   PagedTagMap %8.1f ns/op\n",
+      workload,
+      lockedMapBenchmark(config),
+      pagedMapBenchmark(config));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  bool isQuick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+  Config config{
+      isQuick ? size_t(1000) : size_t(20000),
+      isQuick ? size_t(10000) : size_t(2000000),
+      4};
+
+  report(
+      "insert + erase",
+      benchmarkInsertAndErase<LockedUnorderedMap>,
+      benchmarkInsertAndErase<PagedTagMap<Value>>,
+      config);
+  report(
+      "find on the owner thread",
+      benchmarkLookupsOnOwnerThread<LockedUnorderedMap>,
+      benchmarkLookupsOnOwnerThread<PagedTagMap<Value>>,
+      config);
+  report(
+      "find on 4 reader threads",
+      benchmarkLookupsOnReaderThreads<LockedUnorderedMap>,
+      benchmarkLookupsOnReaderThreads<PagedTagMap<Value>>,
+      config);
+  return 0;
+}
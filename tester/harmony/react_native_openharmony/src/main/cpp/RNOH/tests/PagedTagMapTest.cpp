@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "RNOH/PagedTagMap.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+
+namespace {
+
+struct Value {
+  explicit Value(int tag) : tag(tag) {}
+  ~Value() {
+    isAlive = false;
+  }
+
+  int tag;
+  std::atomic<bool> isAlive{true};
+};
+
+using Map = PagedTagMap<Value>;
+
+void mapsTagsToValues() {
+  Map map;
+  CHECK(map.find(1) == nullptr);
+  CHECK(map.insert(1, std::make_shared<Value>(1)));
+  CHECK(map.insert(2048, std::make_shared<Value>(2048)));
+  CHECK(map.find(1)->tag == 1);
+  CHECK(map.find(2048)->tag == 2048);
+  CHECK(map.find(2) == nullptr);
+  CHECK(map.find(1025) == nullptr);
+}
+
+void keepsTheFirstValueOfATag() {
+  Map map;
+  CHECK(map.insert(7, std::make_shared<Value>(1)));
+  CHECK(!map.insert(7, std::make_shared<Value>(2)));
+  CHECK(map.find(7)->tag == 1);
+}
+
+void erasesValues() {
+  Map map;
+  map.insert(3, std::make_shared<Value>(3));
+  map.insert(4, std::make_shared<Value>(4));
+  auto erased = map.erase(3);
+  CHECK(erased != nullptr && erased->tag == 3);
+  CHECK(map.find(3) == nullptr);
+  CHECK(map.find(4) != nullptr);
+  CHECK(map.erase(3) == nullptr);
+  CHECK(map.erase(5) == nullptr);
+  CHECK(map.erase(Map::PAGE_SIZE * 10) == nullptr);
+}
+
+void reallocatesEmptiedPages() {
+  Map map;
+  Map::Tag tag = Map::PAGE_SIZE * 3 + 5;
+  map.insert(tag, std::make_shared<Value>(1));
+  std::weak_ptr<Value> weakValue = map.find(tag);
+  CHECK(map.erase(tag) != nullptr);
+  CHECK(weakValue.expired());
+  CHECK(map.insert(tag, std::make_shared<Value>(2)));
+  CHECK(map.find(tag)->tag == 2);
+}
+
+void keepsTagsOutsideOfThePageTableInAMap() {
+  Map map;
+  Map::Tag largeTag = Map::PAGE_SIZE * Map::MAX_PAGES_COUNT;
+  CHECK(!Map::isPageable(-1));
+  CHECK(!Map::isPageable(largeTag));
+  CHECK(map.insert(-1, std::make_shared<Value>(-1)));
+  CHECK(map.insert(largeTag, std::make_shared<Value>(largeTag)));
+  CHECK(!map.insert(-1, std::make_shared<Value>(0)));
+  CHECK(map.find(-1)->tag == -1);
+  CHECK(map.find(largeTag)->tag == largeTag);
+  CHECK(map.erase(-1)->tag == -1);
+  CHECK(map.find(-1) == nullptr);
+}
+
+void acceptsInsertsFromManyThreads() {
+  Map map;
+  constexpr int THREADS_COUNT = 4;
+  constexpr int TAGS_PER_THREAD = 5000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS_COUNT; t++) {
+    threads.emplace_back([&map, t] {
+      for (int i = 0; i < TAGS_PER_THREAD; i++) {
+        auto tag = i * THREADS_COUNT + t;
+        map.insert(tag, std::make_shared<Value>(tag));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int tag = 0; tag < THREADS_COUNT * TAGS_PER_THREAD; tag++) {
+    auto value = map.find(tag);
+    CHECK(value != nullptr && value->tag == tag);
+  }
+}
+
+void readersNeverSeeErasedValuesDestroyed() {
+  Map map;
+  constexpr int TAGS_COUNT = 4 * Map::PAGE_SIZE;
+  constexpr int ROUNDS_COUNT = 20;
+  std::atomic<bool> isDone{false};
+  std::atomic<int> deadValuesCount{0};
+  std::atomic<int> wrongValuesCount{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; r++) {
+    readers.emplace_back([&, r] {
+      int tag = r;
+      while (!isDone) {
+        if (auto value = map.find(tag)) {
+          if (!value->isAlive) {
+            deadValuesCount++;
+          }
+          if (value->tag != tag) {
+            wrongValuesCount++;
+          }
+        }
+        tag = (tag + 7) % TAGS_COUNT;
+      }
+    });
+  }
+  // the owner thread replaces every value, emptying and refilling pages
+  for (int round = 0; round < ROUNDS_COUNT; round++) {
+    for (int tag = 0; tag < TAGS_COUNT; tag++) {
+      map.insert(tag, std::make_shared<Value>(tag));
+    }
+    for (int tag = 0; tag < TAGS_COUNT; tag++) {
+      map.erase(tag);
+    }
+  }
+  isDone = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  CHECK(deadValuesCount == 0);
+  CHECK(wrongValuesCount == 0);
+}
+
+} // namespace
+
+int main() {
+  return testing::runTests({
+      {"mapsTagsToValues", mapsTagsToValues},
+      {"keepsTheFirstValueOfATag", keepsTheFirstValueOfATag},
+      {"erasesValues", erasesValues},
+      {"reallocatesEmptiedPages", reallocatesEmptiedPages},
+      {"keepsTagsOutsideOfThePageTableInAMap",
+       keepsTagsOutsideOfThePageTableInAMap},
+      {"acceptsInsertsFromManyThreads", acceptsInsertsFromManyThreads},
+      {"readersNeverSeeErasedValuesDestroyed",
+       readersNeverSeeErasedValuesDestroyed},
+  });
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <thread>
+#include <vector>
+#include "RNOH/TaskExecutor/TaskRunnerHistogram.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+
+namespace {
+
+void countsZerosInTheFirstBucket() {
+  TaskRunnerHistogram histogram;
+  histogram.record(0);
+  histogram.record(0);
+  auto counts = histogram.getCounts();
+  CHECK(counts[0] == 2);
+  CHECK(counts[1] == 0);
+}
+
+void bucketsValuesByPowersOfTwo() {
+  TaskRunnerHistogram histogram;
+  histogram.record(1);
+  histogram.record(2);
+  histogram.record(3);
+  histogram.record(4);
+  histogram.record(1023);
+  histogram.record(1024);
+  auto counts = histogram.getCounts();
+  CHECK(counts[1] == 1);
+  CHECK(counts[2] == 2);
+  CHECK(counts[3] == 1);
+  CHECK(counts[10] == 1);
+  CHECK(counts[11] == 1);
+}
+
+void countsLargeValuesInTheLastBucket() {
+  TaskRunnerHistogram histogram;
+  histogram.record(uint64_t(1) << (TaskRunnerHistogram::BUCKETS_COUNT - 2));
+  histogram.record(uint64_t(1) << 40);
+  histogram.record(UINT64_MAX);
+  auto counts = histogram.getCounts();
+  CHECK(counts[TaskRunnerHistogram::BUCKETS_COUNT - 1] == 3);
+}
+
+void acceptsRecordsFromManyThreads() {
+  TaskRunnerHistogram histogram;
+  constexpr int THREADS_COUNT = 4;
+  constexpr int RECORDS_PER_THREAD = 10000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS_COUNT; t++) {
+    threads.emplace_back([&histogram] {
+      for (int i = 0; i < RECORDS_PER_THREAD; i++) {
+        histogram.record(i % 8);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  uint64_t total = 0;
+  for (auto count : histogram.getCounts()) {
+    total += count;
+  }
+  CHECK(total == THREADS_COUNT * RECORDS_PER_THREAD);
+}
+
+} // namespace
+
+int main() {
+  return testing::runTests({
+      {"countsZerosInTheFirstBucket", countsZerosInTheFirstBucket},
+      {"bucketsValuesByPowersOfTwo", bucketsValuesByPowersOfTwo},
+      {"countsLargeValuesInTheLastBucket", countsLargeValuesInTheLastBucket},
+      {"acceptsRecordsFromManyThreads", acceptsRecordsFromManyThreads},
+  });
+}
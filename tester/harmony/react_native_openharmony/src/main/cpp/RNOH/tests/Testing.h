@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * A minimal harness for host tests. Each test file is an executable which
+ * runs its tests with `runTests` and returns a non-zero status when a check
+ * fails, so that ctest can run it without a test framework.
+ */
+namespace rnoh::testing {
+
+inline int& getFailedChecksCount() {
+  static int failedChecksCount = 0;
+  return failedChecksCount;
+}
+
+inline void reportFailedCheck(char const* file, int line, char const* what) {
+  std::fprintf(stderr, "%s:%d: %s failed\n", file, line, what);
+  getFailedChecksCount()++;
+}
+
+using Tests = std::vector<std::pair<char const*, std::function<void()>>>;
+
+inline int runTests(Tests const& tests) {
+  for (auto const& [name, test] : tests) {
+    auto failedChecksCountBefore = getFailedChecksCount();
+    test();
+    std::printf(
+        "[%s] %s\n",
+        getFailedChecksCount() == failedChecksCountBefore ? "PASS" : "FAIL",
+        name);
+  }
+  return getFailedChecksCount() == 0 ? 0 : 1;
+}
+
+} // namespace rnoh::testing
+
+#define CHECK(condition)                                        \
+  do {                                                          \
+    if (!(condition)) {                                         \
+      rnoh::testing::reportFailedCheck(                         \
+          __FILE__, __LINE__, "CHECK(" #condition ")");         \
+    }                                                           \
+  } while (false)
+
+#define CHECK_THROWS(expression, exceptionType)                 \
+  do {                                                          \
+    bool didThrow = false;                                      \
+    try {                                                       \
+      (void)(expression);                                       \
+    } catch (exceptionType const&) {                            \
+      didThrow = true;                                          \
+    }                                                           \
+    if (!didThrow) {                                            \
+      rnoh::testing::reportFailedCheck(                         \
+          __FILE__,                                             \
+          __LINE__,                                             \
+          "CHECK_THROWS(" #expression ", " #exceptionType ")"); \
+    }                                                           \
+  } while (false)
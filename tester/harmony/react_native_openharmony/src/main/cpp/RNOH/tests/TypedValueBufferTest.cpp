@@ -0,0 +1,358 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "RNOH/TypedValueBuffer.h"
+#include "RNOH/tests/Testing.h"
+
+using namespace rnoh;
+
+namespace {
+
+using Type = TypedValueBuffer::Type;
+using Bytes = TypedValueBuffer::Bytes;
+
+/**
+ * A JSON-like value tree, written to and read from the buffer the way
+ * JSValueBuffer walks JSI and NAPI values.
+ */
+struct Value {
+  Type type = Type::Null;
+  double number = 0;
+  std::string string;
+  std::vector<Value> elements;
+  std::vector<std::string> keys;
+  std::shared_ptr<Bytes> arrayBuffer;
+  size_t callbackIndex = 0;
+};
+
+Value makeBoolean(bool boolean) {
+  Value value;
+  value.type = boolean ? Type::True : Type::False;
+  return value;
+}
+
+Value makeNumber(double number) {
+  Value value;
+  value.type = Type::Number;
+  value.number = number;
+  return value;
+}
+
+Value makeString(std::string string) {
+  Value value;
+  value.type = Type::String;
+  value.string = std::move(string);
+  return value;
+}
+
+Value makeArray(std::vector<Value> elements) {
+  Value value;
+  value.type = Type::Array;
+  value.elements = std::move(elements);
+  return value;
+}
+
+Value makeObject(std::vector<std::string> keys, std::vector<Value> values) {
+  Value value;
+  value.type = Type::Object;
+  value.keys = std::move(keys);
+  value.elements = std::move(values);
+  return value;
+}
+
+Value makeCallback(size_t callbackIndex) {
+  Value value;
+  value.type = Type::Callback;
+  value.callbackIndex = callbackIndex;
+  return value;
+}
+
+Value makeArrayBuffer(Bytes bytes) {
+  Value value;
+  value.type = Type::ArrayBuffer;
+  value.arrayBuffer = std::make_shared<Bytes>(std::move(bytes));
+  return value;
+}
+
+bool operator==(Value const& lhs, Value const& rhs) {
+  if (lhs.type != rhs.type) {
+    return false;
+  }
+  switch (lhs.type) {
+    case Type::Number:
+      // compares bits, so that NaN and -0 are told apart
+      return std::memcmp(&lhs.number, &rhs.number, sizeof(double)) == 0;
+    case Type::String:
+      return lhs.string == rhs.string;
+    case Type::Array:
+      return lhs.elements == rhs.elements;
+    case Type::Object:
+      return lhs.keys == rhs.keys && lhs.elements == rhs.elements;
+    case Type::ArrayBuffer:
+      return *lhs.arrayBuffer == *rhs.arrayBuffer;
+    case Type::Callback:
+      return lhs.callbackIndex == rhs.callbackIndex;
+    default:
+      return true;
+  }
+}
+
+void write(TypedValueBuffer& buffer, Value const& value) {
+  switch (value.type) {
+    case Type::Null:
+      buffer.writeNull();
+      return;
+    case Type::False:
+    case Type::True:
+      buffer.writeBoolean(value.type == Type::True);
+      return;
+    case Type::Number:
+      buffer.writeNumber(value.number);
+      return;
+    case Type::String:
+      buffer.writeString(value.string.data(), value.string.size());
+      return;
+    case Type::Array:
+      buffer.writeArray(value.elements.size());
+      for (auto const& element : value.elements) {
+        write(buffer, element);
+      }
+      return;
+    case Type::Object: {
+      auto objectOffset = buffer.beginObject();
+      for (size_t i = 0; i < value.keys.size(); i++) {
+        buffer.writeKey(value.keys[i].data(), value.keys[i].size());
+        write(buffer, value.elements[i]);
+      }
+      buffer.endObject(objectOffset, value.keys.size());
+      return;
+    }
+    case Type::ArrayBuffer:
+      buffer.writeArrayBuffer(
+          value.arrayBuffer->data(), value.arrayBuffer->size());
+      return;
+    case Type::Callback:
+      buffer.writeCallback(value.callbackIndex);
+      return;
+  }
+}
+
+Value read(TypedValueBuffer::Reader& reader) {
+  Value value;
+  value.type = reader.readType();
+  switch (value.type) {
+    case Type::Number:
+      value.number = reader.readNumber();
+      break;
+    case Type::String: {
+      size_t length;
+      auto data = reader.readString(length);
+      CHECK(data[length] == '\0');
+      value.string.assign(data, length);
+      break;
+    }
+    case Type::Array: {
+      auto length = reader.readSize();
+      for (size_t i = 0; i < length; i++) {
+        value.elements.push_back(read(reader));
+      }
+      break;
+    }
+    case Type::Object: {
+      auto propertiesCount = reader.readSize();
+      for (size_t i = 0; i < propertiesCount; i++) {
+        size_t keyLength;
+        auto key = reader.readString(keyLength);
+        value.keys.emplace_back(key, keyLength);
+        value.elements.push_back(read(reader));
+      }
+      break;
+    }
+    case Type::ArrayBuffer:
+      value.arrayBuffer = reader.readArrayBuffer();
+      break;
+    case Type::Callback:
+      value.callbackIndex = reader.readSize();
+      break;
+    default:
+      break;
+  }
+  return value;
+}
+
+Value roundTrip(Value const& value) {
+  TypedValueBuffer buffer;
+  write(buffer, value);
+  TypedValueBuffer::Reader reader(buffer);
+  return read(reader);
+}
+
+Value makeRandomValue(std::mt19937& random, int depth) {
+  auto kind = random() % (depth > 0 ? 8 : 5);
+  switch (kind) {
+    case 0:
+      return Value{};
+    case 1:
+      return makeBoolean(random() % 2 == 0);
+    case 2:
+      return makeNumber(std::ldexp(double(random()), int(random() % 64) - 32));
+    case 3:
+      return makeString(std::string(random() % 20, char('a' + random() % 26)));
+    case 4: {
+      Bytes bytes(random() % 64);
+      for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(random());
+      }
+      return makeArrayBuffer(std::move(bytes));
+    }
+    case 5:
+    case 6: {
+      std::vector<Value> elements(random() % 6);
+      for (auto& element : elements) {
+        element = makeRandomValue(random, depth - 1);
+      }
+      return makeArray(std::move(elements));
+    }
+    default: {
+      std::vector<std::string> keys;
+      std::vector<Value> values;
+      for (size_t i = random() % 6; i > 0; i--) {
+        keys.push_back("key" + std::to_string(i));
+        values.push_back(makeRandomValue(random, depth - 1));
+      }
+      return makeObject(std::move(keys), std::move(values));
+    }
+  }
+}
+
+void roundTripsPrimitives() {
+  std::vector<Value> values{
+      Value{},
+      makeBoolean(true),
+      makeBoolean(false),
+      makeNumber(0),
+      makeNumber(-0.0),
+      makeNumber(std::numeric_limits<double>::quiet_NaN()),
+      makeNumber(std::numeric_limits<double>::infinity()),
+      makeNumber(std::numeric_limits<double>::max()),
+      makeString(""),
+      makeString("zażółć 😀"),
+      makeString(std::string("a\0b", 3)),
+  };
+  for (auto const& value : values) {
+    CHECK(roundTrip(value) == value);
+  }
+}
+
+void roundTripsNestedObjectsAndArrays() {
+  auto value = makeObject(
+      {"items", "meta", "empty"},
+      {makeArray(
+           {makeNumber(1),
+            makeObject({"name"}, {makeString("row")}),
+            makeArray({makeArray({}), Value{}})}),
+       makeObject(
+           {"buffer", "nested"},
+           {makeArrayBuffer({1, 2, 3}),
+            makeObject({"deeper"}, {makeArray({makeString("x")})})}),
+       makeObject({}, {})});
+  CHECK(roundTrip(value) == value);
+
+  auto deepValue = makeNumber(42);
+  for (int i = 0; i < 200; i++) {
+    deepValue = i % 2 == 0 ? makeArray({deepValue})
+                           : makeObject({"child"}, {deepValue});
+  }
+  CHECK(roundTrip(deepValue) == deepValue);
+}
+
+void roundTripsRandomValues() {
+  std::mt19937 random(1);
+  for (int i = 0; i < 500; i++) {
+    auto value = makeRandomValue(random, 4);
+    CHECK(roundTrip(value) == value);
+  }
+}
+
+void readsManyValuesInOrder() {
+  std::vector<Value> values{
+      makeString("first"),
+      makeArrayBuffer({4, 5}),
+      makeArray({makeArrayBuffer({6})}),
+      makeCallback(1),
+      makeNumber(3)};
+  TypedValueBuffer buffer;
+  for (auto const& value : values) {
+    write(buffer, value);
+  }
+  TypedValueBuffer::Reader reader(buffer);
+  for (auto const& value : values) {
+    CHECK(read(reader) == value);
+  }
+}
+
+void copiesArrayBuffersOnceAndSharesThemWithReaders() {
+  Bytes bytes{1, 2, 3, 4};
+  TypedValueBuffer buffer;
+  buffer.writeArrayBuffer(bytes.data(), bytes.size());
+  bytes[0] = 9;
+  TypedValueBuffer::Reader firstReader(buffer);
+  TypedValueBuffer::Reader secondReader(buffer);
+  firstReader.readType();
+  secondReader.readType();
+  auto const& firstBytes = firstReader.readArrayBuffer();
+  auto const& secondBytes = secondReader.readArrayBuffer();
+  CHECK(firstBytes == secondBytes);
+  CHECK(*firstBytes == Bytes({1, 2, 3, 4}));
+}
+
+void writesPropertiesCountAfterSkippedProperties() {
+  TypedValueBuffer buffer;
+  auto objectOffset = buffer.beginObject();
+  buffer.writeKey("a", 1);
+  buffer.writeNumber(1);
+  // e.g. an `undefined` property is skipped without writing anything
+  buffer.writeKey("c", 1);
+  buffer.writeNull();
+  buffer.endObject(objectOffset, 2);
+  buffer.writeBoolean(true);
+  TypedValueBuffer::Reader reader(buffer);
+  CHECK(read(reader) == makeObject({"a", "c"}, {makeNumber(1), Value{}}));
+  CHECK(read(reader) == makeBoolean(true));
+}
+
+void writesStringsInPlace() {
+  TypedValueBuffer buffer;
+  std::memcpy(buffer.writeStringInPlace(5), "hello", 6);
+  buffer.writeNull();
+  TypedValueBuffer::Reader reader(buffer);
+  CHECK(read(reader) == makeString("hello"));
+  CHECK(read(reader) == Value{});
+}
+
+} // namespace
+
+int main() {
+  return testing::runTests({
+      {"roundTripsPrimitives", roundTripsPrimitives},
+      {"roundTripsNestedObjectsAndArrays", roundTripsNestedObjectsAndArrays},
+      {"roundTripsRandomValues", roundTripsRandomValues},
+      {"readsManyValuesInOrder", readsManyValuesInOrder},
+      {"copiesArrayBuffersOnceAndSharesThemWithReaders",
+       copiesArrayBuffersOnceAndSharesThemWithReaders},
+      {"writesPropertiesCountAfterSkippedProperties",
+       writesPropertiesCountAfterSkippedProperties},
+      {"writesStringsInPlace", writesStringsInPlace},
+  });
+}
@@ -0,0 +1,27 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+/**
+ * The part of HarmonyReactMarker used by the code under test, without its
+ * React Native dependencies. Tests define logMarker to capture the markers.
+ */
+namespace rnoh {
+
+class HarmonyReactMarker {
+ public:
+  enum class HarmonyReactMarkerId {
+    JSVM_CODE_CACHE_LOOKUP_START,
+    JSVM_CODE_CACHE_LOOKUP_STOP,
+    JSVM_CODE_CACHE_SIZE
+  };
+
+  static void logMarker(const HarmonyReactMarkerId, const char* tag);
+};
+
+} // namespace rnoh
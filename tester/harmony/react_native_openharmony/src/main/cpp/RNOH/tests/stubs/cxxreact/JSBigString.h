@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * The JSBigString interface, without the folly dependency of the React
+ * Native header.
+ */
+namespace facebook::react {
+
+class JSBigString {
+ public:
+  JSBigString() = default;
+  JSBigString(const JSBigString&) = delete;
+  JSBigString& operator=(const JSBigString&) = delete;
+  virtual ~JSBigString() {}
+
+  virtual bool isAscii() const = 0;
+  virtual const char* c_str() const = 0;
+  virtual size_t size() const = 0;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <iostream>
+
+/**
+ * The part of the glog API used by the code under test. Messages are
+ * written to stderr, prefixed with their severity.
+ */
+namespace rnoh::testing {
+
+class LogMessage {
+ public:
+  explicit LogMessage(char const* severity) {
+    std::cerr << severity << ": ";
+  }
+
+  ~LogMessage() {
+    std::cerr << std::endl;
+  }
+
+  template <typename T>
+  LogMessage& operator<<(T const& value) {
+    std::cerr << value;
+    return *this;
+  }
+};
+
+} // namespace rnoh::testing
+
+#define LOG(severity) ::rnoh::testing::LogMessage(#severity)
+#define DLOG(severity) LOG(severity)
@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+/**
+ * The part of the OpenHarmony hilog API used by the code under test.
+ * Tests define OH_LOG_Print to capture the lines.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+  LOG_APP = 0,
+} LogType;
+
+typedef enum {
+  LOG_DEBUG = 3,
+  LOG_INFO = 4,
+  LOG_WARN = 5,
+  LOG_ERROR = 6,
+  LOG_FATAL = 7,
+} LogLevel;
+
+int OH_LOG_Print(
+    LogType type,
+    LogLevel level,
+    unsigned int domain,
+    const char* tag,
+    const char* fmt,
+    ...);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+/**
+ * The part of the OpenHarmony rawfile API used by the code under test.
+ * Tests define NativeResourceManager, RawFile and the functions.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct NativeResourceManager;
+typedef struct NativeResourceManager NativeResourceManager;
+
+struct RawFile;
+typedef struct RawFile RawFile;
+
+typedef struct {
+  int fd;
+  long start;
+  long length;
+} RawFileDescriptor;
+
+RawFile* OH_ResourceManager_OpenRawFile(
+    const NativeResourceManager* mgr,
+    const char* fileName);
+
+void OH_ResourceManager_CloseRawFile(RawFile* rawFile);
+
+bool OH_ResourceManager_GetRawFileDescriptorData(
+    const RawFile* rawFile,
+    RawFileDescriptor* descriptor);
+
+bool OH_ResourceManager_ReleaseRawFileDescriptorData(
+    const RawFileDescriptor* descriptor);
+
+#ifdef __cplusplus
+}
+#endif
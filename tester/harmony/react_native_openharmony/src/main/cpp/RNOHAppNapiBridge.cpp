@@ -17,6 +17,7 @@
 #include "RNInstanceFactory.h"
 #include "RNOH/ArkJS.h"
 #include "RNOH/ArkTSBridge.h"
+#include "RNOH/BlobStore.h"
 #include "RNOH/Inspector.h"
 #include "RNOH/LogSink.h"
 #include "RNOH/ParallelCheck.h"
@@ -382,9 +383,15 @@ static napi_value loadScript(napi_env env, napi_callback_info info) {
     };
 
     if (arkJS.isArrayBuffer(args[1])) {
-      std::vector<uint8_t> bundleContents = arkJS.getArrayBuffer(args[1]);
+      void* bundleContents;
+      size_t bundleSize;
+      if (napi_get_arraybuffer_info(
+              env, args[1], &bundleContents, &bundleSize) != napi_ok) {
+        throw std::runtime_error("Failed to get the JS bundle buffer");
+      }
       rnInstance->loadScriptFromBuffer(
-          std::move(bundleContents),
+          static_cast<uint8_t const*>(bundleContents),
+          bundleSize,
           arkJS.getString(args[sourceUrlParamIdx]),
           callback);
     } else {
@@ -571,6 +578,30 @@ static napi_value setSurfaceDisplayMode(napi_env env, napi_callback_info info) {
   return arkJs.getUndefined();
 }
 
+static napi_value setSurfaceComponentInstancePoolCapacity(
+    napi_env env,
+    napi_callback_info info) {
+  return invoke(env, [&] {
+    ArkJS arkJS(env);
+    auto args = arkJS.getCallbackArgs(info, 3);
+    auto instanceId = arkJS.getInteger(args[0]);
+    auto surfaceId = arkJS.getInteger(args[1]);
+    auto capacity = arkJS.getInteger(args[2]);
+    auto rnInstance = maybeGetInstanceById(instanceId);
+    if (!rnInstance) {
+      return arkJS.createFromRNOHError(
+          RNOHError("Failed to get the RNInstance"));
+    }
+    auto rnInstanceCAPIRawPtr =
+        std::dynamic_pointer_cast<RNInstanceCAPI>(rnInstance);
+    if (rnInstanceCAPIRawPtr != nullptr) {
+      rnInstanceCAPIRawPtr->setComponentInstancePoolCapacity(
+          surfaceId, capacity > 0 ? capacity : 0);
+    }
+    return arkJS.getNull();
+  });
+}
+
 static napi_value emitComponentEvent(napi_env env, napi_callback_info info) {
   ArkJS arkJs(env);
   try {
@@ -851,6 +882,113 @@ static napi_value setDeviceInfo(napi_env env, napi_callback_info info) {
   });
 }
 
+/**
+ * Creates an ArrayBuffer over `data`, which is kept alive by `owner` until
+ * the ArrayBuffer is finalized.
+ */
+template <typename Owner>
+static napi_value createExternalArrayBuffer(
+    napi_env env,
+    Owner owner,
+    uint8_t* data,
+    size_t size) {
+  napi_value result;
+  if (size == 0) {
+    void* emptyData;
+    if (napi_create_arraybuffer(env, 0, &emptyData, &result) != napi_ok) {
+      throw std::runtime_error("Failed to create an array buffer");
+    }
+    return result;
+  }
+  auto hint = new Owner(std::move(owner));
+  auto status = napi_create_external_arraybuffer(
+      env,
+      data,
+      size,
+      [](napi_env /*env*/, void* /*data*/, void* hint) {
+        delete static_cast<Owner*>(hint);
+      },
+      hint,
+      &result);
+  if (status != napi_ok) {
+    delete hint;
+    throw std::runtime_error("Failed to create an array buffer");
+  }
+  return result;
+}
+
+/**
+ * Returns an ArrayBuffer over the memory of the new blob, which ArkTS fills
+ * before handing out the blob id.
+ */
+static napi_value allocateBlob(napi_env env, napi_callback_info info) {
+  return invoke(env, [&] {
+    ArkJS arkJS(env);
+    auto args = arkJS.getCallbackArgs(info, 2);
+    auto blobId = arkJS.getString(args[0]);
+    size_t size = arkJS.getDouble(args[1]);
+    auto& blobStore = BlobStore::getInstance();
+    auto data = blobStore.allocate(blobId, size);
+    auto blob = blobStore.find(blobId);
+    if (!blob.has_value()) {
+      throw std::runtime_error("Blob was released while being allocated");
+    }
+    return createExternalArrayBuffer(
+        env, std::move(blob.value()), data, size);
+  });
+}
+
+static napi_value saveBlob(napi_env env, napi_callback_info info) {
+  return invoke(env, [&] {
+    ArkJS arkJS(env);
+    auto args = arkJS.getCallbackArgs(info, 4);
+    auto blobId = arkJS.getString(args[0]);
+    void* data;
+    size_t length;
+    if (napi_get_arraybuffer_info(env, args[1], &data, &length) != napi_ok) {
+      throw std::runtime_error("Failed to get array buffer info");
+    }
+    size_t offset = std::min<size_t>(arkJS.getDouble(args[2]), length);
+    size_t size = std::min<size_t>(arkJS.getDouble(args[3]), length - offset);
+    BlobStore::getInstance().save(
+        std::move(blobId), static_cast<uint8_t*>(data) + offset, size);
+    return arkJS.getUndefined();
+  });
+}
+
+static napi_value getBlob(napi_env env, napi_callback_info info) {
+  return invoke(env, [&] {
+    ArkJS arkJS(env);
+    auto args = arkJS.getCallbackArgs(info, 3);
+    auto blobId = arkJS.getString(args[0]);
+    size_t offset = arkJS.getDouble(args[1]);
+    auto size = arkJS.getDouble(args[2]);
+    auto blob = BlobStore::getInstance().find(
+        blobId,
+        offset,
+        size < 0 ? std::nullopt : std::optional<size_t>(size));
+    if (!blob.has_value()) {
+      return arkJS.getNull();
+    }
+    // blob memory is shared by slices and other ArrayBuffers, so ArkTS gets
+    // a copy-on-write one
+    auto privateCopy = blob->createPrivateCopy();
+    auto data = privateCopy.data();
+    auto copySize = privateCopy.size();
+    return createExternalArrayBuffer(
+        env, std::move(privateCopy), data, copySize);
+  });
+}
+
+static napi_value releaseBlob(napi_env env, napi_callback_info info) {
+  return invoke(env, [&] {
+    ArkJS arkJS(env);
+    auto args = arkJS.getCallbackArgs(info, 1);
+    BlobStore::getInstance().release(arkJS.getString(args[0]));
+    return arkJS.getUndefined();
+  });
+}
+
 EXTERN_C_START
 static napi_value Init(napi_env env, napi_value exports) {
   napi_property_descriptor desc[] = {
@@ -966,6 +1104,14 @@ static napi_value Init(napi_env env, napi_value exports) {
        nullptr,
        napi_default,
        nullptr},
+      {"setSurfaceComponentInstancePoolCapacity",
+       nullptr,
+       setSurfaceComponentInstancePoolCapacity,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
       {"logMarker",
        nullptr,
        logMarker,
@@ -1085,6 +1231,38 @@ static napi_value Init(napi_env env, napi_value exports) {
        nullptr,
        nullptr,
        napi_default,
+       nullptr},
+      {"allocateBlob",
+       nullptr,
+       ::allocateBlob,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"saveBlob",
+       nullptr,
+       ::saveBlob,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"getBlob",
+       nullptr,
+       ::getBlob,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"releaseBlob",
+       nullptr,
+       ::releaseBlob,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
        nullptr}};
 
   napi_define_properties(
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "ClippedSubviewsIndex.h"
+#include <algorithm>
+#include <iterator>
+
+namespace rnoh {
+
+void ClippedSubviewsIndex::build(std::vector<Extent> const& extents) {
+  m_childIndicesByStart.resize(extents.size());
+  for (size_t i = 0; i < extents.size(); i++) {
+    m_childIndicesByStart[i] = i;
+  }
+  std::stable_sort(
+      m_childIndicesByStart.begin(),
+      m_childIndicesByStart.end(),
+      [&](size_t lhs, size_t rhs) {
+        return extents[lhs].start < extents[rhs].start;
+      });
+  m_sortedExtents.clear();
+  m_sortedExtents.reserve(extents.size());
+  m_sortedStarts.clear();
+  m_sortedStarts.reserve(extents.size());
+  m_maxEnds.clear();
+  m_maxEnds.reserve(extents.size());
+  for (auto childIndex : m_childIndicesByStart) {
+    auto const& extent = extents[childIndex];
+    m_sortedExtents.push_back(extent);
+    m_sortedStarts.push_back(extent.start);
+    m_maxEnds.push_back(
+        m_maxEnds.empty() ? extent.end
+                          : std::max(m_maxEnds.back(), extent.end));
+  }
+}
+
+std::vector<size_t> ClippedSubviewsIndex::findVisibleChildIndices(
+    Extent viewport,
+    std::function<bool(size_t)> const& isVisible) const {
+  std::vector<size_t> visibleChildIndices;
+  // children starting after the viewport can't intersect it
+  auto end = std::upper_bound(
+      m_sortedStarts.begin(), m_sortedStarts.end(), viewport.end);
+  for (auto i = end - m_sortedStarts.begin(); i > 0; i--) {
+    if (m_maxEnds[i - 1] < viewport.start) {
+      // no remaining child reaches into the viewport
+      break;
+    }
+    if (m_sortedExtents[i - 1].end < viewport.start) {
+      continue;
+    }
+    auto childIndex = m_childIndicesByStart[i - 1];
+    if (isVisible(childIndex)) {
+      visibleChildIndices.push_back(childIndex);
+    }
+  }
+  std::sort(visibleChildIndices.begin(), visibleChildIndices.end());
+  return visibleChildIndices;
+}
+
+ClippedSubviewsIndex::Diff ClippedSubviewsIndex::diff(
+    std::vector<size_t> const& previousVisibleChildIndices,
+    std::vector<size_t> const& visibleChildIndices) {
+  Diff diff;
+  std::set_difference(
+      previousVisibleChildIndices.begin(),
+      previousVisibleChildIndices.end(),
+      visibleChildIndices.begin(),
+      visibleChildIndices.end(),
+      std::back_inserter(diff.clippedChildIndices));
+  // children are inserted in ascending order, so the position in the new
+  // list of visible children is also the index among the attached children
+  auto previousVisibleChildIt = previousVisibleChildIndices.begin();
+  for (size_t i = 0; i < visibleChildIndices.size(); i++) {
+    auto childIndex = visibleChildIndices[i];
+    previousVisibleChildIt = std::lower_bound(
+        previousVisibleChildIt, previousVisibleChildIndices.end(), childIndex);
+    if (previousVisibleChildIt != previousVisibleChildIndices.end() &&
+        *previousVisibleChildIt == childIndex) {
+      continue;
+    }
+    diff.unclippedChildren.push_back({childIndex, i});
+  }
+  return diff;
+}
+
+} // namespace rnoh
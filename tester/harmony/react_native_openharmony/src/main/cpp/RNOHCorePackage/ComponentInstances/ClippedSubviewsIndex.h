@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * @internal
+ *
+ * Finds the children of a scroll content container that intersect the
+ * viewport along the scroll axis without visiting all of them. Children are
+ * sorted by the start of their extents, with the running maximum of the
+ * extent ends, so that a query only visits the children starting before the
+ * end of the viewport, and stops once no remaining child reaches into it.
+ * Only depends on the standard library, so that it can be tested on a host.
+ */
+class ClippedSubviewsIndex {
+ public:
+  /**
+   * The part of the scroll axis covered by a child or by the viewport,
+   * boundaries included.
+   */
+  struct Extent {
+    double start;
+    double end;
+  };
+
+  /**
+   * Changes turning the attached children from one list of visible
+   * children into another. `clippedChildIndices` are removed first, then
+   * each of `unclippedChildren` is inserted, in order, at `position` among
+   * the attached children.
+   */
+  struct Diff {
+    struct Insertion {
+      size_t childIndex;
+      size_t position;
+    };
+
+    std::vector<size_t> clippedChildIndices;
+    std::vector<Insertion> unclippedChildren;
+  };
+
+  /**
+   * `extents[i]` is the extent of the i-th child along the scroll axis.
+   */
+  void build(std::vector<Extent> const& extents);
+
+  /**
+   * Returns the ascending indices of the children intersecting `viewport`
+   * for which `isVisible` also holds, e.g. along the cross axis.
+   */
+  std::vector<size_t> findVisibleChildIndices(
+      Extent viewport,
+      std::function<bool(size_t)> const& isVisible) const;
+
+  /**
+   * Both lists hold ascending child indices.
+   */
+  static Diff diff(
+      std::vector<size_t> const& previousVisibleChildIndices,
+      std::vector<size_t> const& visibleChildIndices);
+
+ private:
+  std::vector<size_t> m_childIndicesByStart;
+  std::vector<Extent> m_sortedExtents;
+  std::vector<double> m_sortedStarts;
+  std::vector<double> m_maxEnds;
+};
+
+} // namespace rnoh
@@ -19,6 +19,7 @@ CustomNodeComponentInstance::CustomNodeComponentInstance(Context context)
 void CustomNodeComponentInstance::onChildInserted(
     ComponentInstance::Shared const& childComponentInstance, std::size_t index) {
   CppComponentInstance::onChildInserted(childComponentInstance, index);
+  m_isClippedSubviewsIndexValid = false;
   if (m_props->removeClippedSubviews && !m_parent.expired()) {
     return;
   }
@@ -30,6 +31,7 @@ void CustomNodeComponentInstance::onChildRemoved(
     ComponentInstance::Shared const& childComponentInstance)
 {
   CppComponentInstance::onChildRemoved(childComponentInstance);
+  m_isClippedSubviewsIndexValid = false;
   m_childrenClippedState.erase(childComponentInstance->getTag());
   getLocalRootArkUINode().removeChild(childComponentInstance->getLocalRootArkUINode());
 }
@@ -92,7 +94,13 @@ bool CustomNodeComponentInstance::isViewClipped(
   return !rnoh::rectIntersects(scrollRect, child->getLayoutMetrics().frame);
 }
 
+void CustomNodeComponentInstance::onChildFrameChanged() {
+  // the index only depends on the layout frames of the children
+  m_isClippedSubviewsIndexValid = false;
+}
+
 void CustomNodeComponentInstance::restoreClippedSubviews() {
+  m_isClippedSubviewsIndexValid = false;
   size_t i = 0;
   for (const auto& child : m_children) {
     auto tag = child->getTag();
@@ -121,8 +129,69 @@ void CustomNodeComponentInstance::updateClippedSubviews(bool childrenChange) {
 
   m_previousOffset = currentOffset;
 
+  auto isHorizontal = isMainAxisHorizontal(parentBoundingBox);
+  if (childrenChange || !m_isClippedSubviewsIndexValid ||
+      m_isClippedSubviewsIndexHorizontal != isHorizontal) {
+    updateAllClippedSubviews(currentOffset, parentBoundingBox);
+    buildClippedSubviewsIndex(isHorizontal);
+    return;
+  }
+
+  // only the children near the viewport are visited
+  auto viewportStart = isHorizontal ? currentOffset.x : currentOffset.y;
+  auto viewportLength = isHorizontal ? parentBoundingBox.size.width
+                                     : parentBoundingBox.size.height;
+  auto visibleChildIndices = m_clippedSubviewsIndex.findVisibleChildIndices(
+      {viewportStart, viewportStart + viewportLength}, [&](size_t childIndex) {
+        return !isViewClipped(
+            m_children[childIndex], currentOffset, parentBoundingBox);
+      });
+  auto diff = ClippedSubviewsIndex::diff(
+      m_visibleChildIndices, visibleChildIndices);
+  for (auto childIndex : diff.clippedChildIndices) {
+    auto const& child = m_children[childIndex];
+    m_childrenClippedState.insert_or_assign(child->getTag(), true);
+    m_customNode.removeChild(child->getLocalRootArkUINode());
+  }
+  for (auto const& insertion : diff.unclippedChildren) {
+    auto const& child = m_children[insertion.childIndex];
+    m_childrenClippedState.insert_or_assign(child->getTag(), false);
+    m_customNode.insertChild(
+        child->getLocalRootArkUINode(), insertion.position);
+  }
+  m_visibleChildIndices = std::move(visibleChildIndices);
+}
+
+bool CustomNodeComponentInstance::isMainAxisHorizontal(
+    facebook::react::Rect parentBoundingBox) const {
+  auto const& size = m_layoutMetrics.frame.size;
+  return size.width > parentBoundingBox.size.width &&
+      size.height <= parentBoundingBox.size.height;
+}
+
+void CustomNodeComponentInstance::buildClippedSubviewsIndex(bool isHorizontal) {
+  std::vector<ClippedSubviewsIndex::Extent> extents;
+  extents.reserve(m_children.size());
+  for (auto const& child : m_children) {
+    auto const& frame = child->getLayoutMetrics().frame;
+    if (isHorizontal) {
+      extents.push_back({frame.getMinX(), frame.getMaxX()});
+    } else {
+      extents.push_back({frame.getMinY(), frame.getMaxY()});
+    }
+  }
+  m_clippedSubviewsIndex.build(extents);
+  m_isClippedSubviewsIndexHorizontal = isHorizontal;
+  m_isClippedSubviewsIndexValid = true;
+}
+
+void CustomNodeComponentInstance::updateAllClippedSubviews(
+    facebook::react::Point currentOffset,
+    facebook::react::Rect parentBoundingBox) {
+  m_visibleChildIndices.clear();
   size_t nextChildIndex = 0;
-  for (const auto& child : m_children) {
+  for (size_t childIndex = 0; childIndex < m_children.size(); childIndex++) {
+    auto const& child = m_children[childIndex];
     auto tag = child->getTag();
     bool childClipped = isViewClipped(child, currentOffset, parentBoundingBox);
     auto it = m_childrenClippedState.find(tag);
@@ -139,6 +208,7 @@ void CustomNodeComponentInstance::updateClippedSubviews(bool childrenChange) {
     }
 
     if (!childClipped) {
+      m_visibleChildIndices.push_back(childIndex);
       nextChildIndex++;
     }
   }
@@ -9,6 +9,7 @@
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include "RNOH/CppComponentInstance.h"
 #include "RNOH/arkui/CustomNode.h"
+#include "ClippedSubviewsIndex.h"
 
 namespace rnoh {
 class CustomNodeComponentInstance
@@ -18,6 +19,11 @@ class CustomNodeComponentInstance
   CustomNode m_customNode;
   std::unordered_map<facebook::react::Tag, bool> m_childrenClippedState;
   facebook::react::Point m_previousOffset;
+  ClippedSubviewsIndex m_clippedSubviewsIndex;
+  bool m_isClippedSubviewsIndexHorizontal = false;
+  bool m_isClippedSubviewsIndexValid = false;
+  // indices of the children attached to the CustomNode, ascending
+  std::vector<size_t> m_visibleChildIndices;
   bool m_focusable = true;
   bool m_isJSResponder = false;
 
@@ -25,6 +31,11 @@ class CustomNodeComponentInstance
       const ComponentInstance::Shared& child,
       facebook::react::Point currentOffset,
       facebook::react::Rect parentBoundingBox);
+  bool isMainAxisHorizontal(facebook::react::Rect parentBoundingBox) const;
+  void updateAllClippedSubviews(
+      facebook::react::Point currentOffset,
+      facebook::react::Rect parentBoundingBox);
+  void buildClippedSubviewsIndex(bool isHorizontal);
   void setIsJSResponder(bool isJSResponder) override;
   bool isAncestor(int32_t nodeId);
  public:
@@ -38,6 +49,8 @@ class CustomNodeComponentInstance
 
   void onPropsChanged(SharedConcreteProps const& props) override;
 
+  void onChildFrameChanged() override;
+
   void updateClippedSubviews(bool childrenChange = false);
   void restoreClippedSubviews();
 
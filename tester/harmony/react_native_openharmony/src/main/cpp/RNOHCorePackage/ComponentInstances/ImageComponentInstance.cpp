@@ -242,6 +242,17 @@ void ImageComponentInstance::onStateChanged(SharedConcreteState const& state) {
   this->getLocalRootArkUINode().setBlur(state->getData().getBlurRadius());
 }
 
+void ImageComponentInstance::onRecycle() {
+  CppComponentInstance::onRecycle();
+  if (m_props != nullptr) {
+    // make the next onPropsChanged set the sources again, so that load events
+    // are emitted for the new tag even if it shows the same image
+    auto props = std::make_shared<facebook::react::ImageProps>(*m_props);
+    props->sources = {};
+    m_props = props;
+  }
+}
+
 ImageNode& ImageComponentInstance::getLocalRootArkUINode() {
   return m_imageNode;
 }
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <typeinfo>
 
 #include <react/renderer/components/image/ImageEventEmitter.h>
 #include <react/renderer/components/image/ImageShadowNode.h>
@@ -40,6 +41,11 @@ class ImageComponentInstance
   ImageComponentInstance(Context context);
   void onPropsChanged(SharedConcreteProps const& props) override;
   void onStateChanged(SharedConcreteState const& state) override;
+  void onRecycle() override;
+
+  bool isRecyclable() const override {
+    return typeid(*this) == typeid(ImageComponentInstance);
+  }
 
   void onProgress(uint32_t loaded, uint32_t total) override;
   void onComplete(float width, float height) override;
@@ -84,9 +84,13 @@ void ScrollViewComponentInstance::onChildRemoved(
 
 void ScrollViewComponentInstance::setLayout(
     facebook::react::LayoutMetrics layoutMetrics) {
+  auto isFrameChanged = layoutMetrics.frame != m_layoutMetrics.frame;
   getLocalRootArkUINode().setSize(layoutMetrics.frame.size);
   m_scrollNode.setSize(layoutMetrics.frame.size);
   m_layoutMetrics = layoutMetrics;
+  if (isFrameChanged) {
+    notifyParentAboutFrameChange();
+  }
   if (m_containerSize != layoutMetrics.frame.size) {
     m_containerSize = layoutMetrics.frame.size;
   }
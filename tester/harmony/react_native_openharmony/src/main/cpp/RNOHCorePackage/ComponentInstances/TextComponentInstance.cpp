@@ -34,9 +34,9 @@ TextComponentInstance::~TextComponentInstance() {
   for (auto const& item : m_childNodes) {
     m_textNode.removeChild(*item);
   }
-  if (m_key != "") {
+  if (m_key.has_value()) {
     m_textNode.resetTextContentWithStyledString();
-    TextMeasureRegistry::getTextMeasureRegistry().eraseTextMeasureInfo(m_key);
+    TextMeasureRegistry::getTextMeasureRegistry().eraseTextMeasureInfo(m_key.value());
   }
   if (m_state != nullptr) {
     m_state->getData().paragraphLayoutManager.resetCache();
@@ -205,16 +205,15 @@ void TextComponentInstance::onStateChanged(
   VLOG(3) << "[text-debug] getFragments size:" << fragments.size();
   m_textNode.resetTextContentWithStyledString();
   if (fragments.empty()) {
-    if (m_key != "") {
-      TextMeasureRegistry::getTextMeasureRegistry().eraseTextMeasureInfo(m_key);
+    if (m_key.has_value()) {
+      TextMeasureRegistry::getTextMeasureRegistry().eraseTextMeasureInfo(m_key.value());
     }
-    m_key = "";
+    m_key = std::nullopt;
     return;
   }
-  m_key = std::to_string(m_rnInstanceId) + "_" + 
-    std::to_string(fragments[0].parentShadowView.tag) + "_" + 
-    std::to_string(fragments[0].parentShadowView.surfaceId);
-  auto info = TextMeasureRegistry::getTextMeasureRegistry().getTextMeasureInfoByKey(m_key);
+  auto const& parentShadowView = fragments[0].parentShadowView;
+  m_key.emplace(m_rnInstanceId, parentShadowView.surfaceId, parentShadowView.tag);
+  auto info = TextMeasureRegistry::getTextMeasureRegistry().getTextMeasureInfoByKey(m_key.value());
   if (info.has_value()) {
     VLOG(3) << "[text-debug] setTextContentWithStyledString";
     m_textNode.setTextContentWithStyledString(info.value());
@@ -27,7 +27,7 @@ class TextComponentInstance
   FragmentTouchTargetByTag m_fragmentTouchTargetByTag{};
   bool m_touchTargetChildrenNeedUpdate = false;
   bool m_hasCheckNesting = false;
-  std::string m_key;
+  std::optional<TextMeasureKey> m_key;
   std::string m_textContent = "";
 
  public:
@@ -201,6 +201,16 @@ TextInputComponentInstance::getOnContentSizeChangeMetrics() {
   return OnContentSizeChangeMetrics;
 }
 
+bool TextInputComponentInstance::setAnimatedProps(
+    AnimatedProps const& animatedProps) {
+  // the background is also drawn by the text field nodes, which are updated
+  // in `onPropsChanged`
+  if (animatedProps.backgroundColor.has_value()) {
+    return false;
+  }
+  return CppComponentInstance::setAnimatedProps(animatedProps);
+}
+
 void TextInputComponentInstance::onPropsChanged(
     SharedConcreteProps const& props) {
   m_multiline = props->traits.multiline;
@@ -75,6 +75,8 @@ class TextInputComponentInstance
 
   void onPropsChanged(SharedConcreteProps const& props) override;
 
+  bool setAnimatedProps(AnimatedProps const& animatedProps) override;
+
   void onStateChanged(SharedConcreteState const& state) override;
 
   void onLayoutChanged(
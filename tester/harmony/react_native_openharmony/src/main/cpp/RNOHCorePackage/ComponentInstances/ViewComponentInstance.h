@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <typeinfo>
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include "RNOH/CppComponentInstance.h"
 #include "RNOH/arkui/StackNode.h"
@@ -28,9 +29,22 @@ class ViewComponentInstance
   void onLayoutChanged(
       const facebook::react::LayoutMetrics& layoutMetrics) override;
 
+  /**
+   * Only plain Views are recyclable. Subclasses keep state which
+   * `onRecycle` doesn't reset, and must opt in themselves once audited.
+   */
+  bool isRecyclable() const override {
+    return typeid(*this) == typeid(ViewComponentInstance);
+  }
+
   void onClick() override;
   void onHoverIn() override;
   void onHoverOut() override;
   StackNode& getLocalRootArkUINode() override;
+
+ protected:
+  bool shouldIndexTouchTargetChildren() const override {
+    return true;
+  }
 };
 } // namespace rnoh
\ No newline at end of file
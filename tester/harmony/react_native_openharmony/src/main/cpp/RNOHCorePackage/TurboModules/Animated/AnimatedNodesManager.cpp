@@ -32,6 +32,45 @@ using namespace facebook;
 
 namespace rnoh {
 
+folly::dynamic PropUpdate::getProps() const {
+  if (!animatedProps.has_value()) {
+    return props;
+  }
+  folly::dynamic result = folly::dynamic::object;
+  if (animatedProps->opacity.has_value()) {
+    result["opacity"] = animatedProps->opacity.value();
+  }
+  if (animatedProps->transform.has_value()) {
+    result["transform"] = TransformAnimatedNode::transformToDynamic(
+        animatedProps->transform.value());
+  }
+  if (animatedProps->backgroundColor.has_value()) {
+    result["backgroundColor"] = *animatedProps->backgroundColor.value();
+  }
+  return result;
+}
+
+void PropUpdate::merge(PropUpdate&& newerPropUpdate) {
+  if (animatedProps.has_value() &&
+      newerPropUpdate.animatedProps.has_value()) {
+    auto& newerAnimatedProps = newerPropUpdate.animatedProps.value();
+    if (newerAnimatedProps.opacity.has_value()) {
+      animatedProps->opacity = newerAnimatedProps.opacity;
+    }
+    if (newerAnimatedProps.transform.has_value()) {
+      animatedProps->transform = std::move(newerAnimatedProps.transform);
+    }
+    if (newerAnimatedProps.backgroundColor.has_value()) {
+      animatedProps->backgroundColor = newerAnimatedProps.backgroundColor;
+    }
+    return;
+  }
+  auto mergedProps = getProps();
+  mergedProps.update(newerPropUpdate.getProps());
+  props = std::move(mergedProps);
+  animatedProps = std::nullopt;
+}
+
 AnimatedNodesManager::AnimatedNodesManager(
     const std::function<void(int)>& scheduleUpdateFn,
     const std::function<void()>& scheduleStartFn,
@@ -75,12 +114,13 @@ void AnimatedNodesManager::createNode(
 
   node->tag_ = tag;
   m_nodeByTag.insert({tag, std::move(node)});
-  m_nodeTagsToUpdate.insert(tag);
+  m_nodeTagsToUpdate.push_back(tag);
+  invalidateSchedule();
 }
 
 void AnimatedNodesManager::dropNode(facebook::react::Tag tag) {
-  m_nodeTagsToUpdate.erase(tag);
   m_nodeByTag.erase(tag);
+  invalidateSchedule();
 }
 
 void AnimatedNodesManager::connectNodes(
@@ -90,7 +130,8 @@ void AnimatedNodesManager::connectNodes(
   auto& child = getNodeByTag(childTag);
 
   parent.addChild(child);
-  m_nodeTagsToUpdate.insert(childTag);
+  m_nodeTagsToUpdate.push_back(childTag);
+  invalidateSchedule();
 }
 
 void AnimatedNodesManager::disconnectNodes(
@@ -100,7 +141,8 @@ void AnimatedNodesManager::disconnectNodes(
   auto& child = getNodeByTag(childTag);
 
   parent.removeChild(child);
-  m_nodeTagsToUpdate.insert(childTag);
+  m_nodeTagsToUpdate.push_back(childTag);
+  invalidateSchedule();
 }
 
 void AnimatedNodesManager::connectNodeToView(
@@ -108,7 +150,7 @@ void AnimatedNodesManager::connectNodeToView(
     facebook::react::Tag viewTag) {
   auto& node = dynamic_cast<PropsAnimatedNode&>(getNodeByTag(nodeTag));
   node.connectToView(viewTag);
-  m_nodeTagsToUpdate.insert(nodeTag);
+  m_nodeTagsToUpdate.push_back(nodeTag);
   // make sure the new properties are applied immediately even when they're not
   // animated
   maybeStartAnimations();
@@ -191,14 +233,14 @@ PropUpdatesList AnimatedNodesManager::handleEvent(
 void AnimatedNodesManager::setValue(facebook::react::Tag tag, double value) {
   auto& node = getValueNodeByTag(tag);
   stopAnimationsForNode(tag);
-  m_nodeTagsToUpdate.insert(tag);
+  m_nodeTagsToUpdate.push_back(tag);
   node.setValue(value);
   maybeStartAnimations();
 }
 
 void AnimatedNodesManager::setOffset(facebook::react::Tag tag, double offset) {
   auto& node = getValueNodeByTag(tag);
-  m_nodeTagsToUpdate.insert(tag);
+  m_nodeTagsToUpdate.push_back(tag);
   node.setOffset(offset);
   maybeStartAnimations();
 }
@@ -277,7 +319,7 @@ PropUpdatesList AnimatedNodesManager::runUpdates(long long frameTimeNanos) {
     driver->runAnimationStep(frameTimeNanos);
     auto nodeTag = driver->getAnimatedValueTag();
     valueNodeTags.push_back(nodeTag);
-    m_nodeTagsToUpdate.insert(nodeTag);
+    m_nodeTagsToUpdate.push_back(nodeTag);
     if (driver->hasFinished()) {
       finishedAnimations.push_back(animationId);
     }
@@ -319,106 +361,151 @@ PropUpdatesList AnimatedNodesManager::runUpdates(long long frameTimeNanos) {
 }
 
 void AnimatedNodesManager::setNeedsUpdate(facebook::react::Tag nodeTag) {
-  m_nodeTagsToUpdate.insert(nodeTag);
+  m_nodeTagsToUpdate.push_back(nodeTag);
 }
 
 PropUpdatesList AnimatedNodesManager::updateNodes() {
-  std::vector<facebook::react::Tag> nodeTags(
-      m_nodeTagsToUpdate.begin(), m_nodeTagsToUpdate.end());
-  m_nodeTagsToUpdate.clear();
-
-  uint64_t activeNodesCount = 0;
-  uint64_t updatedNodesCount = 0;
-
-  std::queue<react::Tag> nodeTagsQueue;
-  for (auto node : nodeTags) {
-    nodeTagsQueue.push(node);
+  if (m_isScheduleStale) {
+    compileSchedule();
   }
-  std::unordered_set<react::Tag> visitedNodeTags;
-  std::unordered_map<react::Tag, uint64_t> incomingEdgesCount;
-
-  // first, we traverse the nodes graph to find all active nodes
-  // and count incoming edges for each node
-  while (!nodeTagsQueue.empty()) {
-    auto tag = nodeTagsQueue.front();
-    nodeTagsQueue.pop();
-
-    if (visitedNodeTags.find(tag) != visitedNodeTags.end()) {
-      continue;
-    }
-
-    visitedNodeTags.insert(tag);
-    try {
-      auto& node = getNodeByTag(tag);
-      activeNodesCount++;
 
-      for (auto childTag : node.getChildrenTags()) {
-        nodeTagsQueue.push(childTag);
-        incomingEdgesCount[childTag]++;
-      }
-    } catch (const AnimatedNodeNotFoundError& _e) {
+  auto throwCycleError = [this](facebook::react::Tag tag) {
+    std::fill(
+        m_isScheduledNodeDirty.begin(), m_isScheduledNodeDirty.end(), 0);
+    throw std::runtime_error(
+        "Animated node with tag " + std::to_string(tag) +
+        " is part of a cycle and can't be updated");
+  };
+
+  auto firstDirtyIndex = static_cast<uint32_t>(m_schedule.size());
+  std::optional<facebook::react::Tag> cyclicNodeTag;
+  for (auto tag : m_nodeTagsToUpdate) {
+    auto it = m_scheduleIndexByTag.find(tag);
+    if (it == m_scheduleIndexByTag.end()) {
       // if a node is not found we skip over it and proceed with the
       // animation to maintain consistency with other platforms
+      if (m_nodeByTag.find(tag) != m_nodeByTag.end()) {
+        cyclicNodeTag = tag;
+      }
       continue;
     }
+    m_isScheduledNodeDirty[it->second] = 1;
+    firstDirtyIndex = std::min(firstDirtyIndex, it->second);
   }
-
-  // second, we visit all active nodeTags with no incoming edges
-  // (meaning they're either the root nodeTags, or their parents were already
-  // visited) and perform the updates
-  for (auto node : nodeTags) {
-    if (incomingEdgesCount[node] == 0) {
-      nodeTagsQueue.push(node);
-    }
+  m_nodeTagsToUpdate.clear();
+  if (cyclicNodeTag.has_value()) {
+    throwCycleError(cyclicNodeTag.value());
   }
 
+  // parents precede their children in the schedule, so a single pass visits
+  // every node reachable from the dirty ones after all of its parents
   PropUpdatesList propUpdatesList;
-  while (!nodeTagsQueue.empty()) {
-    auto tag = nodeTagsQueue.front();
-    nodeTagsQueue.pop();
+  try {
+    for (auto i = firstDirtyIndex; i < m_schedule.size(); i++) {
+      if (!m_isScheduledNodeDirty[i]) {
+        continue;
+      }
+      m_isScheduledNodeDirty[i] = 0;
+      auto const& scheduledNode = m_schedule[i];
+      try {
+        scheduledNode.node->update();
+
+        if (scheduledNode.propsNode != nullptr) {
+          auto propUpdate = scheduledNode.propsNode->updateView();
+          if (propUpdate.has_value()) {
+            propUpdatesList.push_back(std::move(propUpdate.value()));
+          }
+        }
 
-    try {
-      auto& node = getNodeByTag(tag);
-      node.update();
-
-      if (auto propsNode = dynamic_cast<PropsAnimatedNode*>(&node);
-          propsNode != nullptr) {
-        auto propUpdate = propsNode->updateView();
-        if (propUpdate.has_value()) {
-          propUpdatesList.push_back(std::move(propUpdate.value()));
+        if (scheduledNode.valueNode != nullptr) {
+          scheduledNode.valueNode->onValueUpdate();
         }
+      } catch (const AnimatedNodeNotFoundError& _e) {
+        // if a node is not found we skip over it and proceed with the
+        // animation to maintain consistency with other platforms
+        continue;
       }
 
-      if (auto valueNode = dynamic_cast<ValueAnimatedNode*>(&node);
-          valueNode != nullptr) {
-        valueNode->onValueUpdate();
+      for (auto childIndex = scheduledNode.childrenBegin;
+           childIndex < scheduledNode.childrenEnd;
+           childIndex++) {
+        auto scheduleIndex = m_scheduledChildIndices[childIndex];
+        if (scheduleIndex == UNSCHEDULED_INDEX) {
+          throwCycleError(scheduledNode.node->tag_);
+        }
+        m_isScheduledNodeDirty[scheduleIndex] = 1;
       }
+    }
+  } catch (...) {
+    // nodes left dirty by an aborted walk would be updated by the next frame
+    // even if nothing changed them
+    std::fill(
+        m_isScheduledNodeDirty.begin(), m_isScheduledNodeDirty.end(), 0);
+    throw;
+  }
 
-      updatedNodesCount++;
+  return propUpdatesList;
+}
 
-      for (auto childTag : node.getChildrenTags()) {
-        incomingEdgesCount[childTag]--;
-        if (incomingEdgesCount[childTag] == 0) {
-          nodeTagsQueue.push(childTag);
-        }
+void AnimatedNodesManager::compileSchedule() {
+  m_schedule.clear();
+  m_scheduledChildIndices.clear();
+  m_scheduleIndexByTag.clear();
+
+  std::unordered_map<react::Tag, uint64_t> incomingEdgesCount;
+  for (auto& [tag, node] : m_nodeByTag) {
+    for (auto childTag : node->getChildrenTags()) {
+      if (m_nodeByTag.find(childTag) != m_nodeByTag.end()) {
+        incomingEdgesCount[childTag]++;
       }
+    }
+  }
 
-    } catch (const AnimatedNodeNotFoundError& _e) {
-      // if a node is not found we skip over it and proceed with the
-      // animation to maintain consistency with other platforms
-      continue;
+  std::queue<AnimatedNode*> nodesQueue;
+  for (auto& [tag, node] : m_nodeByTag) {
+    if (incomingEdgesCount[tag] == 0) {
+      nodesQueue.push(node.get());
     }
   }
-  if (activeNodesCount != updatedNodesCount) {
-    // if not all active nodes were updated, it means there's a cycle in the
-    // graph
-    throw std::runtime_error(
-        "There were " + std::to_string(activeNodesCount) +
-        " active nodes, but only " + std::to_string(updatedNodesCount) +
-        " were updated");
+  std::vector<AnimatedNode*> sortedNodes;
+  sortedNodes.reserve(m_nodeByTag.size());
+  while (!nodesQueue.empty()) {
+    auto node = nodesQueue.front();
+    nodesQueue.pop();
+    m_scheduleIndexByTag.emplace(node->tag_, sortedNodes.size());
+    sortedNodes.push_back(node);
+    for (auto childTag : node->getChildrenTags()) {
+      auto childIt = m_nodeByTag.find(childTag);
+      if (childIt != m_nodeByTag.end() && --incomingEdgesCount[childTag] == 0) {
+        nodesQueue.push(childIt->second.get());
+      }
+    }
   }
 
-  return propUpdatesList;
+  m_schedule.reserve(sortedNodes.size());
+  for (auto node : sortedNodes) {
+    auto childrenBegin = static_cast<uint32_t>(m_scheduledChildIndices.size());
+    for (auto childTag : node->getChildrenTags()) {
+      auto it = m_scheduleIndexByTag.find(childTag);
+      if (it != m_scheduleIndexByTag.end()) {
+        m_scheduledChildIndices.push_back(it->second);
+      } else if (m_nodeByTag.find(childTag) != m_nodeByTag.end()) {
+        m_scheduledChildIndices.push_back(UNSCHEDULED_INDEX);
+      }
+    }
+    m_schedule.push_back(
+        {node,
+         dynamic_cast<PropsAnimatedNode*>(node),
+         dynamic_cast<ValueAnimatedNode*>(node),
+         childrenBegin,
+         static_cast<uint32_t>(m_scheduledChildIndices.size())});
+  }
+  m_isScheduledNodeDirty.assign(m_schedule.size(), 0);
+  m_isScheduleStale = false;
+}
+
+void AnimatedNodesManager::invalidateSchedule() {
+  m_isScheduleStale = true;
 }
 
 void AnimatedNodesManager::stopAnimationsForNode(facebook::react::Tag tag) {
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <limits>
 #include <unordered_map>
 
 #include <folly/dynamic.h>
@@ -17,13 +18,34 @@
 #include "Drivers/AnimationDriver.h"
 #include "Drivers/EventAnimationDriver.h"
 #include "Nodes/AnimatedNode.h"
+#include "RNOH/AnimatedProps.h"
 #include "RNOH/ApiVersionCheck.h"
 
 namespace rnoh {
-using PropUpdate = std::pair<facebook::react::Tag, folly::dynamic>;
+struct PropUpdate {
+  facebook::react::Tag tag;
+  folly::dynamic props;
+  /**
+   * Set instead of `props` when every animated prop of the view has a typed
+   * representation.
+   */
+  std::optional<AnimatedProps> animatedProps;
+
+  /**
+   * Returns `props`, or `animatedProps` in the RawProps format.
+   */
+  folly::dynamic getProps() const;
+
+  /**
+   * Overwrites the props of this update with the ones set by a newer update
+   * of the same view.
+   */
+  void merge(PropUpdate&& newerPropUpdate);
+};
 using PropUpdatesList = std::vector<PropUpdate>;
 
 class AnimatedNode;
+class PropsAnimatedNode;
 class ValueAnimatedNode;
 class AnimationDriver;
 class EventAnimationDriver;
@@ -96,7 +118,31 @@ class AnimatedNodesManager {
   ValueAnimatedNode& getValueNodeByTag(facebook::react::Tag tag);
 
  private:
+  /**
+   * A node of the graph in topological order, with the casts needed to
+   * update it resolved ahead of time.
+   */
+  struct ScheduledNode {
+    AnimatedNode* node;
+    PropsAnimatedNode* propsNode;
+    ValueAnimatedNode* valueNode;
+    // range of `m_scheduledChildIndices`
+    uint32_t childrenBegin;
+    uint32_t childrenEnd;
+  };
+
+  // children that are part of a cycle can't be scheduled
+  static constexpr uint32_t UNSCHEDULED_INDEX =
+      std::numeric_limits<uint32_t>::max();
+
   PropUpdatesList updateNodes();
+  /**
+   * Sorts the whole graph topologically. Called on the first update after
+   * nodes were added, removed, connected or disconnected, so that a frame
+   * only needs to walk the schedule.
+   */
+  void compileSchedule();
+  void invalidateSchedule();
   void stopAnimationsForNode(facebook::react::Tag tag);
   void maybeStartAnimations();
   int32_t getMinAcceptableFrameRate(
@@ -110,7 +156,12 @@ class AnimatedNodesManager {
   std::unordered_map<facebook::react::Tag, std::unique_ptr<AnimationDriver>>
       m_animationById;
   std::vector<std::unique_ptr<EventAnimationDriver>> m_eventDrivers;
-  std::unordered_set<facebook::react::Tag> m_nodeTagsToUpdate;
+  std::vector<facebook::react::Tag> m_nodeTagsToUpdate;
+  std::vector<ScheduledNode> m_schedule;
+  std::vector<uint32_t> m_scheduledChildIndices;
+  std::unordered_map<facebook::react::Tag, uint32_t> m_scheduleIndexByTag;
+  std::vector<uint8_t> m_isScheduledNodeDirty;
+  bool m_isScheduleStale = true;
   bool m_isRunningAnimations = false;
 };
 
@@ -544,33 +544,87 @@ void NativeAnimatedTurboModule::runUpdates(long long frameTimeNanos) {
   auto lock = this->acquireLock();
   try {
     auto tagsToUpdate = this->m_animatedNodesManager.runUpdates(frameTimeNanos);
+    this->commitPropUpdates(std::move(tagsToUpdate));
+  } catch (std::exception& e) {
+    LOG(ERROR) << "Error in animation update: " << e.what();
+    if (!IsAtLeastApi20()) {
+        this->requestAnimationFrame();
+    }
+  }
+}
 
-    if (m_ctx.taskExecutor->isOnTaskThread(TaskThread::MAIN)) {
-      this->setNativeProps(tagsToUpdate);
-      return;
+void NativeAnimatedTurboModule::commitPropUpdates(
+    PropUpdatesList&& propUpdates) {
+  if (propUpdates.empty()) {
+    return;
+  }
+  auto isOnMainThread = m_ctx.taskExecutor->isOnTaskThread(TaskThread::MAIN);
+  // updates staged while a commit is applied (e.g. from events it triggers)
+  // are left for the next one
+  auto shouldCommitNow = isOnMainThread && !m_isCommittingPropUpdates;
+  auto shouldScheduleCommit = false;
+  {
+    std::lock_guard<std::mutex> lock(m_stagedPropUpdatesMtx);
+    for (auto& propUpdate : propUpdates) {
+      auto [it, inserted] = m_stagedPropUpdateIndexByTag.try_emplace(
+          propUpdate.tag, m_stagedPropUpdates.size());
+      if (inserted) {
+        m_stagedPropUpdates.push_back(std::move(propUpdate));
+      } else {
+        m_stagedPropUpdates[it->second].merge(std::move(propUpdate));
+      }
     }
+    if (!shouldCommitNow && !m_isCommitScheduled) {
+      m_isCommitScheduled = true;
+      shouldScheduleCommit = true;
+    }
+  }
+  if (shouldCommitNow) {
+    commitStagedPropUpdates();
+    return;
+  }
+  if (shouldScheduleCommit) {
     m_ctx.taskExecutor->runTask(
-        TaskThread::MAIN,
-        [weakSelf = weak_from_this(), tagsToUpdate = std::move(tagsToUpdate)] {
-          auto self = weakSelf.lock();
-          if (!self) {
-            return;
+        TaskThread::MAIN, [weakSelf = weak_from_this()] {
+          if (auto self = weakSelf.lock()) {
+            self->commitStagedPropUpdates();
           }
-          self->setNativeProps(tagsToUpdate);
         });
+  }
+}
+
+void NativeAnimatedTurboModule::commitStagedPropUpdates() {
+  {
+    std::lock_guard<std::mutex> lock(m_stagedPropUpdatesMtx);
+    m_isCommitScheduled = false;
+    std::swap(m_committedPropUpdates, m_stagedPropUpdates);
+    m_stagedPropUpdateIndexByTag.clear();
+  }
+  if (m_committedPropUpdates.empty()) {
+    return;
+  }
+  m_isCommittingPropUpdates = true;
+  try {
+    setNativeProps(m_committedPropUpdates);
   } catch (std::exception& e) {
-    LOG(ERROR) << "Error in animation update: " << e.what();
-    if (!IsAtLeastApi20()) {
-        this->requestAnimationFrame();
-    }
+    LOG(ERROR) << "Error in animated props commit: " << e.what();
   }
+  // keeps the capacity for the next frame
+  m_committedPropUpdates.clear();
+  m_isCommittingPropUpdates = false;
 }
 
 void NativeAnimatedTurboModule::setNativeProps(
     PropUpdatesList const& tagsToUpdate) {
   if (auto instance = m_ctx.safeInstance.lock(); instance != nullptr) {
-    for (auto const& [tag, props] : tagsToUpdate) {
-      instance->synchronouslyUpdateViewOnUIThread(tag, props);
+    for (auto const& propUpdate : tagsToUpdate) {
+      if (propUpdate.animatedProps.has_value() &&
+          instance->synchronouslyUpdateAnimatedPropsOnUIThread(
+              propUpdate.tag, propUpdate.animatedProps.value())) {
+        continue;
+      }
+      instance->synchronouslyUpdateViewOnUIThread(
+          propUpdate.tag, propUpdate.getProps());
     }
     return;
   }
@@ -651,7 +705,7 @@ void NativeAnimatedTurboModule::handleComponentEvent(
   try {
     auto propUpdates =
         m_animatedNodesManager.handleEvent(tag, eventName, payload);
-    setNativeProps(propUpdates);
+    commitPropUpdates(std::move(propUpdates));
   } catch (std::exception& e) {
     LOG(ERROR) << "handleEvent Error in animation update: " << e.what();
   }
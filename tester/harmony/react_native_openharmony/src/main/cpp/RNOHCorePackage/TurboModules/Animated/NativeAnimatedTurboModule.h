@@ -144,6 +144,18 @@ class NativeAnimatedTurboModule
 
   void requestAnimationFrame();
 
+  /**
+   * Stages the updates and commits them on MAIN. Updates staged before the
+   * commit runs are coalesced, so a view is updated at most once per commit,
+   * with the newest value of every prop.
+   */
+  void commitPropUpdates(PropUpdatesList&& propUpdates);
+
+  /**
+   * @thread: MAIN
+   */
+  void commitStagedPropUpdates();
+
   int32_t m_currentFrameRate = 0;
   std::unique_ptr<OH_DisplaySoloist, void (*)(OH_DisplaySoloist*)>
       m_nativeDisplaySoloist;
@@ -155,6 +167,14 @@ class NativeAnimatedTurboModule
   AnimatedNodesManager m_animatedNodesManager;
   std::mutex m_nodesManagerLock;
   bool m_initializedEventListener = false;
+
+  std::mutex m_stagedPropUpdatesMtx;
+  PropUpdatesList m_stagedPropUpdates;
+  std::unordered_map<facebook::react::Tag, size_t> m_stagedPropUpdateIndexByTag;
+  bool m_isCommitScheduled = false;
+  // the buffer swapped with `m_stagedPropUpdates` on commit, MAIN only
+  PropUpdatesList m_committedPropUpdates;
+  bool m_isCommittingPropUpdates = false;
 };
 
 } // namespace rnoh
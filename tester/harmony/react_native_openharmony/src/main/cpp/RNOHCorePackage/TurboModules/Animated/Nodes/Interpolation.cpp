@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#include "Interpolation.h"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+namespace rnoh::interpolation {
+
+static bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+/**
+ * Finds the end of a number matching `[-+]?[0-9]*\.?[0-9]+` that starts at
+ * `begin`, or returns `begin` if there's none.
+ */
+static size_t findNumberEnd(std::string const& str, size_t begin) {
+  auto index = begin;
+  if (index < str.size() && (str[index] == '-' || str[index] == '+')) {
+    index++;
+  }
+  auto integerEnd = index;
+  while (integerEnd < str.size() && isDigit(str[integerEnd])) {
+    integerEnd++;
+  }
+  if (integerEnd + 1 < str.size() && str[integerEnd] == '.' &&
+      isDigit(str[integerEnd + 1])) {
+    auto fractionEnd = integerEnd + 1;
+    while (fractionEnd < str.size() && isDigit(str[fractionEnd])) {
+      fractionEnd++;
+    }
+    return fractionEnd;
+  }
+  if (integerEnd > index) {
+    return integerEnd;
+  }
+  return begin;
+}
+
+static void appendNumber(std::string& result, double value) {
+  // same format as `std::to_string`, without a temporary string
+  char buffer[32];
+  auto length = std::snprintf(buffer, sizeof(buffer), "%f", value);
+  if (length < 0 || static_cast<size_t>(length) >= sizeof(buffer)) {
+    result += std::to_string(value);
+    return;
+  }
+  result.append(buffer, length);
+}
+
+ExtrapolateType extrapolateTypeFromString(std::string const& extrapolateType) {
+  if (extrapolateType == "identity") {
+    return ExtrapolateType::EXTRAPOLATE_TYPE_IDENTITY;
+  } else if (extrapolateType == "clamp") {
+    return ExtrapolateType::EXTRAPOLATE_TYPE_CLAMP;
+  } else if (extrapolateType == "extend") {
+    return ExtrapolateType::EXTRAPOLATE_TYPE_EXTEND;
+  } else {
+    throw std::runtime_error(
+        "Invalid extrapolation type " + extrapolateType + " provided.");
+  }
+}
+
+StringOutput StringOutput::parse(std::string const& output) {
+  StringOutput stringOutput;
+  size_t literalBegin = 0;
+  size_t index = 0;
+  while (index < output.size()) {
+    auto numberEnd = findNumberEnd(output, index);
+    if (numberEnd == index) {
+      index++;
+      continue;
+    }
+    stringOutput.literals.push_back(
+        output.substr(literalBegin, index - literalBegin));
+    stringOutput.values.push_back(
+        std::stod(output.substr(index, numberEnd - index)));
+    index = numberEnd;
+    literalBegin = numberEnd;
+  }
+  stringOutput.literals.push_back(output.substr(literalBegin));
+  for (auto const& literal : stringOutput.literals) {
+    stringOutput.literalsLength += literal.size();
+  }
+  return stringOutput;
+}
+
+size_t findRangeIndex(std::vector<double> const& inputRange, double value) {
+  // the first inner boundary not below the value ends the range
+  auto boundary =
+      std::lower_bound(inputRange.begin() + 1, inputRange.end() - 1, value);
+  return boundary - inputRange.begin() - 1;
+}
+
+double interpolate(
+    double value,
+    double inputMin,
+    double inputMax,
+    double outputMin,
+    double outputMax,
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight) {
+  double result = value;
+
+  if (result < inputMin) {
+    if (extrapolateLeft == ExtrapolateType::EXTRAPOLATE_TYPE_IDENTITY) {
+      return result;
+    } else if (extrapolateLeft == ExtrapolateType::EXTRAPOLATE_TYPE_CLAMP) {
+      result = inputMin;
+    } else if (extrapolateLeft == ExtrapolateType::EXTRAPOLATE_TYPE_EXTEND) {
+      // noop
+    } else {
+      // this should never happen, since we've already checked the extrapolation
+      // type
+      throw std::runtime_error(
+          "Invalid extrapolation type for left extrapolation");
+    }
+  }
+
+  if (result > inputMax) {
+    if (extrapolateRight == ExtrapolateType::EXTRAPOLATE_TYPE_IDENTITY) {
+      return result;
+    } else if (extrapolateRight == ExtrapolateType::EXTRAPOLATE_TYPE_CLAMP) {
+      result = inputMax;
+    } else if (extrapolateRight == ExtrapolateType::EXTRAPOLATE_TYPE_EXTEND) {
+      // noop
+    } else {
+      // this should never happen
+      throw std::runtime_error(
+          "Invalid extrapolation type for right extrapolation");
+    }
+  }
+
+  if (outputMin == outputMax) {
+    return outputMin;
+  }
+
+  if (inputMin == inputMax) {
+    if (value >= inputMax) {
+      return outputMax;
+    } else {
+      return outputMin;
+    }
+  }
+
+  double inputRange = inputMax - inputMin;
+  double outputRange = outputMax - outputMin;
+
+  return outputMin + outputRange * (result - inputMin) / inputRange;
+}
+
+std::string interpolateString(
+    StringOutput const& start,
+    StringOutput const& end,
+    double ratio) {
+  std::string result;
+  result.reserve(start.literalsLength + start.values.size() * 16);
+  result += start.literals[0];
+  for (size_t i = 0; i < start.values.size(); ++i) {
+    auto startValue = start.values[i];
+    auto endValue = i < end.values.size() ? end.values[i] : startValue;
+    appendNumber(result, startValue + ratio * (endValue - startValue));
+    result += start.literals[i + 1];
+  }
+  return result;
+}
+
+} // namespace rnoh::interpolation
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE-MIT file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * @internal
+ *
+ * Evaluation of the typed ranges InterpolationAnimatedNode parses from its
+ * config. Only depends on the standard library, so that it can be tested
+ * and benchmarked on a host.
+ */
+namespace interpolation {
+
+enum ExtrapolateType {
+  EXTRAPOLATE_TYPE_IDENTITY,
+  EXTRAPOLATE_TYPE_CLAMP,
+  EXTRAPOLATE_TYPE_EXTEND
+};
+
+ExtrapolateType extrapolateTypeFromString(std::string const& extrapolateType);
+
+/**
+ * A string output split around the numbers it contains, e.g.
+ * "rotate(45deg)" is stored as literals {"rotate(", "deg)"} and values
+ * {45}. There's always one more literal than values.
+ */
+struct StringOutput {
+  std::vector<std::string> literals;
+  std::vector<double> values;
+  size_t literalsLength = 0;
+
+  static StringOutput parse(std::string const& output);
+};
+
+/**
+ * Returns the index of the range of `inputRange` which `value` falls into,
+ * or the first or the last range if it's outside of `inputRange`.
+ * `inputRange` must be non-decreasing and have at least 2 elements.
+ */
+size_t findRangeIndex(std::vector<double> const& inputRange, double value);
+
+double interpolate(
+    double value,
+    double inputMin,
+    double inputMax,
+    double outputMin,
+    double outputMax,
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight);
+
+/**
+ * Replaces the numbers of `start` with the numbers interpolated towards the
+ * matching ones of `end`, formatted like `std::to_string`.
+ */
+std::string interpolateString(
+    StringOutput const& start,
+    StringOutput const& end,
+    double ratio);
+
+} // namespace interpolation
+} // namespace rnoh
@@ -8,8 +8,11 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "AnimatedNode.h"
+#include "Interpolation.h"
+#include "RNOH/Color.h"
 #include "RNOHCorePackage/TurboModules/Animated/AnimatedNodesManager.h"
 #include "ValueAnimatedNode.h"
 
@@ -27,12 +30,6 @@ class InterpolationAnimatedNode : public ValueAnimatedNode {
   void onDetachedFromNode(facebook::react::Tag tag) override;
 
  private:
-  enum ExtrapolateType {
-    EXTRAPOLATE_TYPE_IDENTITY,
-    EXTRAPOLATE_TYPE_CLAMP,
-    EXTRAPOLATE_TYPE_EXTEND
-  };
-
   enum OutputType {
     Number,
     Color,
@@ -40,25 +37,16 @@ class InterpolationAnimatedNode : public ValueAnimatedNode {
     Unknown,
   };
 
-  static ExtrapolateType extrapolateTypeFromString(
-      std::string const& extrapolateType);
-
-  ExtrapolateType m_extrapolateLeft;
-  ExtrapolateType m_extrapolateRight;
-
-  double interpolate(
-      double value,
-      double inputMin,
-      double inputMax,
-      double outputMin,
-      double outputMax,
-      ExtrapolateType extrapolateLeft,
-      ExtrapolateType extrapolateRight) const;
+  interpolation::ExtrapolateType m_extrapolateLeft;
+  interpolation::ExtrapolateType m_extrapolateRight;
 
   ValueAnimatedNode& getParentNode() const;
 
-  folly::dynamic m_inputRange;
-  folly::dynamic m_outputRange;
+  // the ranges are parsed once, only the output of `m_outputType` is filled
+  std::vector<double> m_inputRange;
+  std::vector<double> m_outputNumbers;
+  std::vector<rnoh::Color> m_outputColors;
+  std::vector<interpolation::StringOutput> m_outputStrings;
   OutputType m_outputType;
   std::optional<facebook::react::Tag> m_parent;
   AnimatedNodesManager& m_nodesManager;
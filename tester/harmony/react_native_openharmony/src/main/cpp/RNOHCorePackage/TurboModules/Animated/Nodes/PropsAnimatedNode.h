@@ -46,6 +46,11 @@ class PropsAnimatedNode : public AnimatedNode {
           << "PropsAnimatedNode::updateView() called on unconnected node";
       return std::nullopt;
     }
+    if (auto animatedProps = getAnimatedProps(); animatedProps.has_value()) {
+      return PropUpdate{
+          .tag = m_viewTag.value(),
+          .animatedProps = std::move(animatedProps)};
+    }
     folly::dynamic props = folly::dynamic::object;
     for (auto& [key, nodeTag] : m_tagByPropName) {
       auto node = &m_nodesManager.getNodeByTag(nodeTag);
@@ -59,10 +64,29 @@ class PropsAnimatedNode : public AnimatedNode {
         throw std::runtime_error("Unsupported property animated node type");
       }
     }
-    return std::make_pair(m_viewTag.value(), props);
+    return PropUpdate{.tag = m_viewTag.value(), .props = std::move(props)};
   }
 
  private:
+  /**
+   * Returns the props if all of them come from the style and can be applied
+   * to the view without building RawProps.
+   */
+  std::optional<AnimatedProps> getAnimatedProps() const {
+    AnimatedProps animatedProps;
+    for (auto& [key, nodeTag] : m_tagByPropName) {
+      auto styleNode = dynamic_cast<StyleAnimatedNode*>(
+          &m_nodesManager.getNodeByTag(nodeTag));
+      if (styleNode == nullptr || !styleNode->getAnimatedProps(animatedProps)) {
+        return std::nullopt;
+      }
+    }
+    if (animatedProps.empty()) {
+      return std::nullopt;
+    }
+    return animatedProps;
+  }
+
   std::optional<facebook::react::Tag> m_viewTag;
   std::unordered_map<std::string, facebook::react::Tag> m_tagByPropName;
   AnimatedNodesManager& m_nodesManager;
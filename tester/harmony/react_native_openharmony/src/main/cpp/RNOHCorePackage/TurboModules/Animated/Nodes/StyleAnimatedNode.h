@@ -44,7 +44,55 @@ class StyleAnimatedNode : public AnimatedNode {
     return style;
   }
 
+  /**
+   * Writes the style into `animatedProps`. Returns false if some of the
+   * animated style props don't have a typed representation.
+   */
+  bool getAnimatedProps(AnimatedProps& animatedProps) const {
+    for (auto& [key, nodeTag] : m_tagByPropName) {
+      auto node = &m_nodesManager.getNodeByTag(nodeTag);
+      if (auto valueNode = dynamic_cast<ValueAnimatedNode*>(node);
+          valueNode != nullptr) {
+        if (!setAnimatedProp(animatedProps, key, *valueNode)) {
+          return false;
+        }
+      } else if (auto transformNode =
+                     dynamic_cast<TransformAnimatedNode*>(node);
+                 transformNode != nullptr && key == "transform") {
+        animatedProps.transform = transformNode->getTransformMatrix();
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
  private:
+  static bool setAnimatedProp(
+      AnimatedProps& animatedProps,
+      std::string const& key,
+      ValueAnimatedNode& valueNode) {
+    if (key == "opacity") {
+      auto output = valueNode.getOutput();
+      if (!output.isNumber()) {
+        return false;
+      }
+      animatedProps.opacity = output.asDouble();
+      return true;
+    }
+    if (key == "backgroundColor") {
+      // interpolated colors are stored as packed ARGB integers
+      auto output = valueNode.getOutput();
+      if (!output.isInt()) {
+        return false;
+      }
+      animatedProps.backgroundColor = facebook::react::SharedColor(
+          static_cast<facebook::react::Color>(output.getInt()));
+      return true;
+    }
+    return false;
+  }
+
   std::unordered_map<std::string, facebook::react::Tag> m_tagByPropName;
   AnimatedNodesManager& m_nodesManager;
 };
@@ -46,27 +46,6 @@ static Transform applyTransformOperation(
   return transform * operation;
 }
 
-static folly::dynamic transformToDynamic(Transform const& transform) {
-  auto const& matrix = transform.matrix;
-  return folly::dynamic::array(
-      matrix[0],
-      matrix[1],
-      matrix[2],
-      matrix[3],
-      matrix[4],
-      matrix[5],
-      matrix[6],
-      matrix[7],
-      matrix[8],
-      matrix[9],
-      matrix[10],
-      matrix[11],
-      matrix[12],
-      matrix[13],
-      matrix[14],
-      matrix[15]);
-}
-
 TransformAnimatedNode::TransformAnimatedNode(
     folly::dynamic const& config,
     AnimatedNodesManager& nodesManager)
@@ -90,7 +69,7 @@ TransformAnimatedNode::TransformAnimatedNode(
   }
 }
 
-folly::dynamic TransformAnimatedNode::getTransform() const {
+Transform TransformAnimatedNode::getTransformMatrix() const {
   Transform transform;
   for (auto config : m_transforms) {
     double value;
@@ -114,8 +93,34 @@ folly::dynamic TransformAnimatedNode::getTransform() const {
 
     transform = applyTransformOperation(transform, property, value);
   }
-  return folly::dynamic::array(
-      folly::dynamic::object("matrix", transformToDynamic(transform)));
+  return transform;
+}
+
+folly::dynamic TransformAnimatedNode::getTransform() const {
+  return transformToDynamic(getTransformMatrix());
+}
+
+folly::dynamic TransformAnimatedNode::transformToDynamic(
+    Transform const& transform) {
+  auto const& matrix = transform.matrix;
+  auto matrixArray = folly::dynamic::array(
+      matrix[0],
+      matrix[1],
+      matrix[2],
+      matrix[3],
+      matrix[4],
+      matrix[5],
+      matrix[6],
+      matrix[7],
+      matrix[8],
+      matrix[9],
+      matrix[10],
+      matrix[11],
+      matrix[12],
+      matrix[13],
+      matrix[14],
+      matrix[15]);
+  return folly::dynamic::array(folly::dynamic::object("matrix", matrixArray));
 }
 
 } // namespace rnoh
\ No newline at end of file
@@ -24,6 +24,17 @@ class TransformAnimatedNode : public AnimatedNode {
 
   folly::dynamic getTransform() const;
 
+  /**
+   * The transform operations composed into a single matrix.
+   */
+  facebook::react::Transform getTransformMatrix() const;
+
+  /**
+   * Converts the matrix into the `transform` prop format.
+   */
+  static folly::dynamic transformToDynamic(
+      facebook::react::Transform const& transform);
+
  private:
   using NodeTag = facebook::react::Tag;
 
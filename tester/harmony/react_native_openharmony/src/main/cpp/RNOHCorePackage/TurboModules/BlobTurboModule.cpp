@@ -6,52 +6,111 @@
  */
 
 #include "RNOHCorePackage/TurboModules/BlobTurboModule.h"
+#include "RNOH/BlobStore.h"
 
 namespace rnoh {
 using namespace facebook;
 
+namespace {
+/**
+ * Exposes a copy-on-write copy of blob memory to the JS runtime, so that JS
+ * may write to the ArrayBuffer without changing the blob.
+ */
+class BlobMutableBuffer : public jsi::MutableBuffer {
+ public:
+  explicit BlobMutableBuffer(BlobStore::PrivateCopy privateCopy)
+      : m_privateCopy(std::move(privateCopy)) {}
+
+  size_t size() const override {
+    return m_privateCopy.size();
+  }
+
+  uint8_t* data() override {
+    return m_privateCopy.data();
+  }
+
+ private:
+  BlobStore::PrivateCopy m_privateCopy;
+};
+
+BlobStore::BlobSlice getBlobSlice(jsi::Runtime& rt, jsi::Object const& blob) {
+  return {
+      blob.getProperty(rt, "blobId").asString(rt).utf8(rt),
+      static_cast<size_t>(blob.getProperty(rt, "offset").asNumber()),
+      static_cast<size_t>(blob.getProperty(rt, "size").asNumber())};
+}
+
+jsi::Value createBlobFromParts(
+    jsi::Runtime& rt,
+    react::TurboModule& /*turboModule*/,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto jsiParts = args[0].asObject(rt).asArray(rt);
+  auto blobId = args[1].asString(rt).utf8(rt);
+  std::vector<BlobStore::Part> parts;
+  auto partsCount = jsiParts.size(rt);
+  parts.reserve(partsCount);
+  for (size_t i = 0; i < partsCount; i++) {
+    auto part = jsiParts.getValueAtIndex(rt, i).asObject(rt);
+    auto type = part.getProperty(rt, "type").asString(rt).utf8(rt);
+    auto data = part.getProperty(rt, "data");
+    if (type == "blob") {
+      parts.push_back(getBlobSlice(rt, data.asObject(rt)));
+    } else if (type == "string") {
+      parts.push_back(data.asString(rt).utf8(rt));
+    } else {
+      throw jsi::JSError(rt, "Invalid type for blob: " + type);
+    }
+  }
+  BlobStore::getInstance().createFromParts(std::move(blobId), parts);
+  return jsi::Value::undefined();
+}
+
+jsi::Value releaseBlob(
+    jsi::Runtime& rt,
+    react::TurboModule& /*turboModule*/,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  BlobStore::getInstance().release(args[0].asString(rt).utf8(rt));
+  return jsi::Value::undefined();
+}
+
+jsi::Value getBlobArrayBuffer(
+    jsi::Runtime& rt,
+    react::TurboModule& /*turboModule*/,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  auto blobSlice = getBlobSlice(rt, args[0].asObject(rt));
+  auto blob = BlobStore::getInstance().find(
+      blobSlice.blobId, blobSlice.offset, blobSlice.size);
+  if (!blob.has_value()) {
+    return jsi::Value::null();
+  }
+  return jsi::ArrayBuffer(
+      rt, std::make_shared<BlobMutableBuffer>(blob->createPrivateCopy()));
+}
+} // namespace
+
 BlobTurboModule::BlobTurboModule(
     const ArkTSTurboModule::Context ctx,
     const std::string name)
     : ArkTSTurboModule(ctx, name) {
   methodMap_ = {
       ARK_METHOD_METADATA(getConstants, 0),
-      ARK_METHOD_METADATA(release, 1),
+      {"release", {1, releaseBlob}},
       ARK_METHOD_METADATA(sendOverSocket, 2),
       ARK_METHOD_METADATA(addWebSocketHandler, 1),
       ARK_METHOD_METADATA(addNetworkingHandler, 0),
       ARK_METHOD_METADATA(removeWebSocketHandler, 1),
-      ARK_METHOD_METADATA(createFromParts, 2)};
+      {"createFromParts", {2, createBlobFromParts}},
+      {"getArrayBuffer", {1, getBlobArrayBuffer}}};
 }
 
 /**
- * This method is used because calling the generated method 'release' is
- * cumbersome.
+ * Called by BlobCollector when a JS Blob is garbage collected.
  */
 void BlobTurboModule::release(std::string blobId) {
-  m_ctx.taskExecutor->runTask(
-      m_ctx.turboModuleThread, 
-      [env = m_ctx.env,
-        arkTSTurboModuleRef = m_ctx.arkTSTurboModuleInstanceRef,
-        name = name_,
-        blobId]() {
-          std::string methodName = "release";
-          try {
-            ArkJS arkJS(env);
-            if (!arkTSTurboModuleRef) {
-              return;
-            }
-            std::vector<napi_value> napiArgs;
-            napiArgs.push_back(arkJS.createString(blobId));
-            auto napiTurboModuleObject =
-                arkJS.getObject(arkTSTurboModuleRef);
-            napiTurboModuleObject.call(methodName, napiArgs);
-          } catch (const std::exception& e) {
-            LOG(ERROR) << "Exception thrown while calling " << name
-                      << " TurboModule method " << methodName << ": "
-                      << e.what();
-          }
-      });
+  BlobStore::getInstance().release(blobId);
 }
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
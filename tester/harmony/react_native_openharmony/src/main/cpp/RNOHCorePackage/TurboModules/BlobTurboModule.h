@@ -12,10 +12,15 @@
 
 namespace rnoh {
 
+/**
+ * Blob contents are kept in the BlobStore. `createFromParts`, `release` and
+ * `getArrayBuffer` are handled natively, other methods go to ArkTS.
+ * `getArrayBuffer` doesn't copy large blobs unless JS writes to them.
+ */
 class JSI_EXPORT BlobTurboModule : public ArkTSTurboModule {
  public:
   BlobTurboModule(const ArkTSTurboModule::Context ctx, const std::string name);
   void release(const std::string blobId);
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
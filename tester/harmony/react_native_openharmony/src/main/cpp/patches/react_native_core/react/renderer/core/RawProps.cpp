@@ -11,9 +11,7 @@
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsParser.h>
 // RNOH patch add header file
-#ifdef PARALLELIZATION_ON
-#include <ffrt/cpp/pattern/job_partner.h>
-#endif
+#include "RNOH/parallel/ParallelExecutor.h"
 
 namespace facebook::react {
 
@@ -51,6 +49,18 @@ RawProps::RawProps(folly::dynamic const& dynamic) noexcept {
   dynamic_ = dynamic;
 }
 
+// RNOH patch begin
+RawProps::RawProps(folly::dynamic&& dynamic) noexcept {
+  if (dynamic.isNull()) {
+    mode_ = Mode::Empty;
+    return;
+  }
+
+  mode_ = Mode::Dynamic;
+  dynamic_ = std::move(dynamic);
+}
+// RNOH patch end
+
 void RawProps::parse(
     RawPropsParser const& parser,
     const PropsParserContext& /*unused*/) const noexcept {
@@ -66,24 +76,17 @@ void RawProps::parse(
  * will be removed as soon Android implementation does not need it.
  */
 RawProps::operator folly::dynamic() const noexcept {
-// RNOH patch begin
-#ifdef PARALLELIZATION_ON
-  folly::dynamic dynamicValue;
-#endif
-// RNOH patch end
   switch (mode_) {
     case Mode::Empty:
       return folly::dynamic::object();
-    case Mode::JSI:
+    case Mode::JSI: {
 // RNOH patch begin
-#ifdef PARALLELIZATION_ON
-      ffrt::job_partner<>::submit_to_master(
+      folly::dynamic dynamicValue;
+      rnoh::ParallelExecutor::runOnCallerThread(
           [&] { dynamicValue = jsi::dynamicFromValue(*runtime_, value_); });
       return dynamicValue;
-#else
-      return jsi::dynamicFromValue(*runtime_, value_);
-#endif
 // RNOH patch end
+    }
     case Mode::Dynamic:
       return dynamic_;
   }
@@ -14,9 +14,7 @@
 
 #include <glog/logging.h>
 // RNOH patch add header file
-#ifdef PARALLELIZATION_ON
-#include <ffrt/cpp/pattern/job_partner.h>
-#endif
+#include "RNOH/parallel/ParallelExecutor.h"
 
 namespace facebook::react {
 
@@ -117,8 +115,9 @@ void RawPropsParser::preparse(RawProps const& rawProps) const noexcept {
 
     case RawProps::Mode::JSI: {
 // RNOH patch begin
-#ifdef PARALLELIZATION_ON
-      auto parsePropsTask = [&] {
+      // shadow nodes may be created on ParallelExecutor workers, while JSI
+      // is only accessible on the JS thread
+      rnoh::ParallelExecutor::runOnCallerThread([&] {
         auto& runtime = *rawProps.runtime_;
         if (!rawProps.value_.isObject()) {
           LOG(ERROR) << "Preparse props: rawProps value is not object";
@@ -148,40 +147,7 @@ void RawPropsParser::preparse(RawProps const& rawProps) const noexcept {
               RawValue(jsi::dynamicFromValue(runtime, value)));
           valueIndex++;
         }
-      };
-
-      ffrt::job_partner<>::submit_to_master(parsePropsTask);
-#else
-      auto &runtime = *rawProps.runtime_;
-      if (!rawProps.value_.isObject()) {
-        LOG(ERROR) << "Preparse props: rawProps value is not object";
-      }
-      react_native_assert(rawProps.value_.isObject());
-      auto object = rawProps.value_.asObject(runtime);
-
-      auto names = object.getPropertyNames(runtime);
-      auto count = names.size(runtime);
-      auto valueIndex = RawPropsValueIndex{0};
-
-      for (size_t i = 0; i < count; i++) {
-        auto nameValue = names.getValueAtIndex(runtime, i).getString(runtime);
-        auto value = object.getProperty(runtime, nameValue);
-
-        auto name = nameValue.utf8(runtime);
-
-        auto keyIndex = nameToIndex_.at(
-            name.data(), static_cast<RawPropsPropNameLength>(name.size()));
-
-        if (keyIndex == kRawPropsValueIndexEmpty) {
-          continue;
-        }
-
-        rawProps.keyIndexToValueIndex_[keyIndex] = valueIndex;
-        rawProps.values_.push_back(
-            RawValue(jsi::dynamicFromValue(runtime, value)));
-        valueIndex++;
-      }
-#endif
+      });
 // RNOH patch end
       break;
     }
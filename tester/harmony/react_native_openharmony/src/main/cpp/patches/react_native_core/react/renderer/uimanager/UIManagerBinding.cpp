@@ -21,18 +21,32 @@
 #include "bindingUtils.h"
 // RNOH patch begin
 #ifdef PARALLELIZATION_ON
-#include <ffrt/cpp/pattern/job_partner.h>
-#include "RNOH/FFRTConfig.h"
-inline auto g_prehot = ffrt::submit_h(
-    [] {},
-    {},
-    {},
-    ffrt::task_attr().name("prehot").qos(ffrt::qos_user_initiated));
+#include "RNOH/parallel/ParallelExecutor.h"
 #endif
 // RNOH patch end
 
 namespace facebook::react {
 
+// RNOH patch begin
+#ifdef PARALLELIZATION_ON
+// Converts the update payload into `folly::dynamic` on the JS thread, so that
+// workers can parse props without going back to the JS thread for JSI.
+static std::shared_ptr<RawProps> rawPropsSnapshotFromValue(
+    jsi::Runtime& runtime,
+    jsi::Value const& value) {
+  if (value.isObject()) {
+    try {
+      return std::make_shared<RawProps>(jsi::dynamicFromValue(runtime, value));
+    } catch (jsi::JSError const& error) {
+      // e.g. a Symbol prop, which only the JSI RawProps can hold
+      LOG(WARNING) << "Couldn't snapshot props: " << error.getMessage();
+    }
+  }
+  return std::make_shared<RawProps>(runtime, value);
+}
+#endif
+// RNOH patch end
+
 void UIManagerBinding::createAndInstallIfNeeded(
     jsi::Runtime& runtime,
     std::shared_ptr<UIManager> const& uiManager) {
@@ -270,147 +284,49 @@ jsi::Value UIManagerBinding::get(
           auto pnode = jsi::String::createFromAscii(runtime, "node");
           auto pcobj = jsi::String::createFromAscii(runtime, "cobj");
 
-          auto job_partner =
-              ffrt::job_partner<rnoh::ScenarioID::SHADOW_TREE_PARALLELIZATION>::get_partner_of_this_thread(
-                  ffrt::job_partner_attr()
-                      .max_parallelism(rnoh::MAX_THREAD_NUM_SHADOW_TREE)
-                      .qos(rnoh::THREAD_PRIORITY_LEVEL_5));
-
-          constexpr uint64_t GROUP_NUM = 2; // [opt] switch for number of groups
-          constexpr uint64_t GROUP_NUM2 = 100; // [opt] switch for number of subgroups
-          constexpr uint64_t stack_size = 32 * 1024;
-          static std::array<char, stack_size> stack[GROUP_NUM * GROUP_NUM2];
-          uint64_t group = (arrayLength + GROUP_NUM - 1) / GROUP_NUM;
-          {
-            SystraceSection s(
-                "UIManagerBinding::batchCreateNode:", arrayLength);
-            size_t ijob = 0;
-            for (size_t i = 0; i < arrayLength; ++i) {
-              auto nodeParamObj = nodeParamsArray.getValueAtIndex(runtime, i)
-                                      .getObject(runtime);
-              nodes.emplace_back(nodeParamObj.getProperty(runtime, pnode)
-                                     .getObject(runtime));
-              auto tag =
-                  tagFromValue(nodeParamObj.getProperty(runtime, ptag));
-              params.emplace_back(
-                  tag,
-                  stringFromValue(
-                      runtime,
-                      nodeParamObj.getProperty(runtime, puiViewClassName)),
-                  surfaceIdFromValue(
-                      runtime,
-                      nodeParamObj.getProperty(runtime, prenderLanes)),
-                  std::make_shared<RawProps>(
-                      runtime,
-                      nodeParamObj.getProperty(runtime, pupdatePayload)),
-                  eventTargetFromValue(
-                      runtime,
-                      nodeParamObj.getProperty(runtime, pworkInProgress),
-                      tag));
-              auto p = &params[i];
-              if (!p->eventTarget) {
-                react_native_assert(false);
-                return jsi::Value::undefined();
-              }
-              // Handle small scale directly
-              if (arrayLength < GROUP_NUM * GROUP_NUM2) {
-                auto sn = uiManager->createNode(
-                    p->tag,
-                    p->name,
-                    p->surfaceId,
-                    *p->rawProps,
-                    p->eventTarget);
-                nodes[i].setProperty(
-                    runtime, pcobj, valueFromShadowNode(runtime, sn));
-                continue;
-              }
-              if ((i % group) == (group - 1) || i == (arrayLength - 1)) {
-                job_partner->submit(
-                    [&runtime,
-                     &params,
-                     &nodes,
-                     &pcobj,
-                     uiManager,
-                     i,
-                     group,
-                     &job_partner,
-                     stack_base = &stack[ijob * GROUP_NUM2]] {
-                      auto istart = i / group * group;
-                      auto num = i - istart + 1;
-                      uint64_t group2 = (num + GROUP_NUM2 - 1) /
-                          GROUP_NUM2; // Number of calculations per group
-                      uint64_t group_num2 =
-                          (num + group2 - 1) / group2; // Actual number of groups
-                      // Assign the first group_num2 - 1 groups to others
-                      for (uint64_t g2 = 0; g2 < group_num2 - 1; g2++) {
-                        job_partner->submit(
-                            [&runtime,
-                             &params,
-                             &nodes,
-                             &pcobj,
-                             uiManager,
-                             istart,
-                             g2,
-                             group2,
-                             &job_partner] {
-                              auto is = istart + g2 * group2;
-                              for (uint64_t j = is; j < is + group2; j++) {
-                                auto p = &params[j];
-                                auto sn = uiManager->createNode(
-                                    p->tag,
-                                    p->name,
-                                    p->surfaceId,
-                                    *p->rawProps,
-                                    p->eventTarget);
-                                auto& node = nodes[j];
-                                if (job_partner->this_thread_is_master()) {
-                                  node.setProperty(
-                                      runtime,
-                                      pcobj,
-                                      valueFromShadowNode(runtime, sn));
-                                } else
-                                  job_partner->submit_to_master([&] {
-                                    node.setProperty(
-                                        runtime,
-                                        pcobj,
-                                        valueFromShadowNode(runtime, sn));
-                                  });
-                              }
-                            },
-                            &stack_base[g2 + 1],
-                            stack_size);
-                      }
-                      // Process the last group in this thread（JS）
-                      auto is = istart + (group_num2 - 1) * group2;
-                      for (uint64_t j = is; j <= i; j++) {
-                        auto p = &params[j];
-                        auto sn = uiManager->createNode(
-                            p->tag,
-                            p->name,
-                            p->surfaceId,
-                            *p->rawProps,
-                            p->eventTarget);
-                        auto& node = nodes[j];
-                        if (job_partner->this_thread_is_master()) {
-                          node.setProperty(
-                              runtime,
-                              pcobj,
-                              valueFromShadowNode(runtime, sn));
-                        } else
-                          job_partner->submit_to_master([&] {
-                            node.setProperty(
-                                runtime,
-                                pcobj,
-                                valueFromShadowNode(runtime, sn));
-                          });
-                      }
-                    },
-                    &stack[ijob * GROUP_NUM2],
-                    stack_size);
-                ijob++;
-              }
+          // learned across calls, so that small batches stay on the JS thread
+          // and large ones are split according to how expensive nodes are
+          static rnoh::ParallelExecutor::IterationCost createNodeCost(
+              std::chrono::microseconds(20));
+
+          SystraceSection s("UIManagerBinding::batchCreateNode:", arrayLength);
+          for (size_t i = 0; i < arrayLength; ++i) {
+            auto nodeParamObj =
+                nodeParamsArray.getValueAtIndex(runtime, i).getObject(runtime);
+            nodes.emplace_back(
+                nodeParamObj.getProperty(runtime, pnode).getObject(runtime));
+            auto tag = tagFromValue(nodeParamObj.getProperty(runtime, ptag));
+            params.emplace_back(
+                tag,
+                stringFromValue(
+                    runtime,
+                    nodeParamObj.getProperty(runtime, puiViewClassName)),
+                surfaceIdFromValue(
+                    runtime, nodeParamObj.getProperty(runtime, prenderLanes)),
+                rawPropsSnapshotFromValue(
+                    runtime, nodeParamObj.getProperty(runtime, pupdatePayload)),
+                eventTargetFromValue(
+                    runtime,
+                    nodeParamObj.getProperty(runtime, pworkInProgress),
+                    tag));
+            if (!params.back().eventTarget) {
+              react_native_assert(false);
+              return jsi::Value::undefined();
             }
-            job_partner->wait();
+          }
+
+          // props are snapshots, so workers don't need the JS thread until
+          // all nodes are created
+          std::vector<ShadowNode::Shared> shadowNodes(arrayLength);
+          rnoh::ParallelExecutor::getInstance().parallelFor(
+              arrayLength, createNodeCost, [&](size_t i) {
+                auto& p = params[i];
+                shadowNodes[i] = uiManager->createNode(
+                    p.tag, p.name, p.surfaceId, *p.rawProps, p.eventTarget);
+              });
+          for (size_t i = 0; i < arrayLength; ++i) {
+            nodes[i].setProperty(
+                runtime, pcobj, valueFromShadowNode(runtime, shadowNodes[i]));
           }
 
           return jsi::Value::undefined();
@@ -63,6 +63,8 @@ inline static ShadowNode::Shared shadowNodeFromValue(
   } else {
 // RNOH patch begin
 #ifdef PARALLELIZATION_ON
+    // nodes created by batchCreateNode keep their shadow node in `cobj`;
+    // JS only uses it when parallelization is enabled
     auto obj = value.getObject(runtime);
     if (obj.isHostObject<ShadowNodeWrapper>(runtime)) {
       return obj.getHostObject<ShadowNodeWrapper>(runtime)->shadowNode;
@@ -10,6 +10,7 @@
 #include <react/renderer/debug/DebugStringConvertible.h>
 
 #include <unordered_set>
+#include <vector>
 
 #include <react/renderer/components/view/Touch.h>
 
@@ -38,6 +39,13 @@ struct TouchEvent {
    * and started on the element that is the target of the current event.
    */
   Touches targetTouches;
+
+  /*
+   * RNOH: patch
+   * Samples of the changed touches that were coalesced into a `touchmove`
+   * event, oldest first, without the samples in `changedTouches`.
+   */
+  std::vector<Touch> historicalTouches{};
 };
 
 #if RN_DEBUG_STRING_CONVERTIBLE
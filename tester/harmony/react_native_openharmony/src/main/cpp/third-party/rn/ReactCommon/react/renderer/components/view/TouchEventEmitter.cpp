@@ -55,6 +55,18 @@ static jsi::Value touchEventPayload(
     auto const &firstChangedTouch = *event.changedTouches.begin();
     setTouchPayloadOnObject(object, runtime, firstChangedTouch);
   }
+  // RNOH: patch
+  if (!event.historicalTouches.empty()) {
+    auto historicalTouches =
+        jsi::Array(runtime, event.historicalTouches.size());
+    for (size_t i = 0; i < event.historicalTouches.size(); i++) {
+      auto touchObject = jsi::Object(runtime);
+      setTouchPayloadOnObject(
+          touchObject, runtime, event.historicalTouches[i]);
+      historicalTouches.setValueAtIndex(runtime, i, touchObject);
+    }
+    object.setProperty(runtime, "historicalTouches", historicalTouches);
+  }
   return object;
 }
 
@@ -362,6 +362,11 @@ export class NapiBridge {
     this.libRNOHApp?.setSurfaceDisplayMode(instanceId, surfaceTag, displayMode);
   }
 
+  setSurfaceComponentInstancePoolCapacity(instanceId: number, surfaceTag: Tag, capacity: number): void {
+    const result = this.libRNOHApp?.setSurfaceComponentInstancePoolCapacity(instanceId, surfaceTag, capacity)
+    this.unwrapResult(result);
+  }
+
   callRNFunction(instanceId: number, moduleName: string, functionName: string, args: unknown[]): void {
     this.libRNOHApp?.callRNFunction(instanceId, moduleName, functionName, args);
   }
@@ -436,6 +441,29 @@ export class NapiBridge {
     return this.unwrapResult(result);
   }
 
+  /**
+   * Creates a blob in the native BlobStore and returns its memory, to be filled before the blob id is handed out.
+   */
+  allocateBlob(blobId: string, size: number): ArrayBuffer {
+    return this.unwrapResult<ArrayBuffer>(this.libRNOHApp?.allocateBlob(blobId, size));
+  }
+
+  saveBlob(blobId: string, buffer: ArrayBuffer, offset: number, size: number): void {
+    this.unwrapResult(this.libRNOHApp?.saveBlob(blobId, buffer, offset, size));
+  }
+
+  /**
+   * Returns the blob contents, or null if the blob doesn't exist. Pass -1 as the size to get the rest of the blob. Large
+   * blobs are mapped copy-on-write, so the ArrayBuffer may be written without changing the blob.
+   */
+  getBlob(blobId: string, offset: number, size: number): ArrayBuffer | null {
+    return this.unwrapResult<ArrayBuffer | null>(this.libRNOHApp?.getBlob(blobId, offset, size));
+  }
+
+  releaseBlob(blobId: string): void {
+    this.unwrapResult(this.libRNOHApp?.releaseBlob(blobId));
+  }
+
   getDeviceInfo(): string {
     const originalDeviceType: string = deviceInfo.deviceType; // 'phone' | 'tablet' | 'pc'
     let deviceType = 'phone';
@@ -211,6 +211,17 @@ export class SurfaceHandle {
     this.napiBridge.setSurfaceDisplayMode(this.rnInstance.getId(), this.tag, displayMode);
   }
 
+  /**
+   * Limits how many deleted component instances this surface keeps for reuse by newly created components.
+   * Only available in C-API architecture. 0 disables recycling for this surface.
+   */
+  public setComponentInstancePoolCapacity(capacity: number) {
+    if (this.destroyed) {
+      throw new Error("setComponentInstancePoolCapacity called on a destroyed surface");
+    }
+    this.napiBridge.setSurfaceComponentInstancePoolCapacity(this.rnInstance.getId(), this.tag, capacity);
+  }
+
   public getProps(): SurfaceProps {
     return this.props;
   }
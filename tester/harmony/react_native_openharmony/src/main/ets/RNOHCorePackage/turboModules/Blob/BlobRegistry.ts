@@ -7,11 +7,16 @@
 
 import Url from '@ohos.url'
 import util from '@ohos.util';
-import { Blob, BlobMetadata, BlobPart } from './types';
-
+import type { NapiBridge } from '../../../RNOH/NapiBridge';
+import { Blob, BlobMetadata } from './types';
 
+/**
+ * Blob contents are owned by the native BlobStore, which is shared with the C++ side of BlobTurboModule.
+ * ArrayBuffers returned by the registry are views of the native memory, so they aren't copied and must not be modified.
+ */
 export class BlobRegistry {
-  private blobById: Map<string, Blob> = new Map();
+  constructor(private napiBridge: NapiBridge) {
+  }
 
   findByUri(uri: string): Blob | null {
     const url = Url.URL.parseURL(uri);
@@ -30,70 +35,37 @@ export class BlobRegistry {
     return this.findById(blobId ?? '', offset, size);
   }
 
+  /**
+   * Pass -1 as the size to get the rest of the blob.
+   */
   findById(blobId: string, offset: number, size: number): Blob | null {
-    const data = this.blobById.get(blobId);
-    if (!data) {
-      return null;
-    }
-    if (size === -1) {
-      size = data.byteLength - offset;
-    }
-
-    if (offset > 0 || size !== data.byteLength) {
-      const bytes = new Uint8Array(data, offset, size);
-      return bytes.buffer;
-    }
-    return data;
+    return this.napiBridge.getBlob(blobId, offset, size);
   }
 
   findByMetadata(blobMetadata: BlobMetadata): Blob | null {
     return this.findById(blobMetadata.blobId, blobMetadata.offset, blobMetadata.size);
   }
 
-  appendPartsToBlob(parts: Array<BlobPart>, blobId: string): void {
-    let totalBlobSize: number = 0;
-    let partList: Array<ArrayBuffer> = new Array<ArrayBuffer>(parts.length);
-
-    for (let i = 0; i < parts.length; i++) {
-      let part = parts[i];
-      switch (part.type) {
-        case "blob":
-          let blobMetadata = part.data as BlobMetadata;
-          totalBlobSize += blobMetadata.size;
-          partList[i] = this.findByMetadata(blobMetadata);
-          break;
-        case "string":
-          let textEncoder = new util.TextEncoder();
-          let blob: Blob = textEncoder.encodeInto(part.data as string).buffer;
-          totalBlobSize += blob.byteLength;
-          partList[i] = blob;
-          break;
-        default:
-          throw new Error("Invalid type for blob: " + part["type"]);
-      }
-    }
-    const blob: Blob = new ArrayBuffer(totalBlobSize);
-    const bufferView = new Uint8Array(blob);
-    let pos = 0;
-    for (let part of partList) {
-      let partView = new Uint8Array(part);
-      bufferView.set(partView, pos);
-      pos += part.byteLength;
-    }
-    this.saveWithId(blob, blobId);
+  /**
+   * Creates a blob whose memory can be filled in place, e.g. by reading a file into the returned buffer.
+   * The buffer must be filled before the blob id is handed out.
+   */
+  allocate(size: number): { blobId: string, buffer: Blob } {
+    const blobId: string = util.generateRandomUUID();
+    const buffer = this.napiBridge.allocateBlob(blobId, size);
+    return { blobId, buffer };
   }
 
-  save(blob: Blob): string {
+  /**
+   * Copies the bytes into a new blob.
+   */
+  save(blob: Blob, offset: number = 0, size: number = blob.byteLength - offset): string {
     const blobId: string = util.generateRandomUUID();
-    this.saveWithId(blob, blobId);
+    this.napiBridge.saveBlob(blobId, blob, offset, size);
     return blobId;
   }
 
-  saveWithId(blob: Blob, blobId: string): void {
-    this.blobById.set(blobId, blob);
-  }
-
   deleteBlobById(blobId: string) {
-    this.blobById.delete(blobId);
+    this.napiBridge.releaseBlob(blobId);
   }
-}
\ No newline at end of file
+}
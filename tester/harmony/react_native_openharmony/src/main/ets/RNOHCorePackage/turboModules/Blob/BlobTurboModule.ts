@@ -11,17 +11,19 @@ import fs from '@ohos.file.fs';
 import { ContentHandler, WebSocketTurboModule } from '../WebSocketTurboModule';
 import { NetworkingTurboModule, RequestBodyHandler, ResponseBodyHandler, UriHandler } from '../Networking/index';
 import uri from '@ohos.uri';
-import { Blob, BlobMetadata, BlobPart } from './types';
+import { Blob, BlobMetadata } from './types';
 import { BlobRegistry } from './BlobRegistry';
+import { NapiBridge } from '../../../RNOH/NapiBridge';
 
 /**
  * BlobTurboModule implements js Blobs. NetworkingTurboModule handlers are used, to allow handling blobs differently than normal data.
  * Reading the data stored in Blobs is implemented by FileReaderTurboModule.
+ * Blob contents live in the native BlobStore; `createFromParts` and `release` are handled by the C++ side of this module.
  */
 
 export class BlobTurboModule extends AnyThreadTurboModule {
   public static readonly NAME = 'BlobModule';
-  private blobRegistry: BlobRegistry = new BlobRegistry()
+  private blobRegistry: BlobRegistry = new BlobRegistry(new NapiBridge(this.ctx.logger))
 
   private contentHandler: ContentHandler = {
     processMessage: (params) => {
@@ -56,10 +58,9 @@ export class BlobTurboModule extends AnyThreadTurboModule {
         // assets can't be handled using normal file API's
         const path = query.url.replace("asset://", this.ctx.rnInstance.getAssetsDest())
         const bytes = this.ctx.uiAbilityContext.resourceManager.getRawFileContentSync(path);
-        const blob = bytes.buffer;
         return {
-          blobId: this.blobRegistry.save(blob),
-          offset: bytes.byteOffset,
+          blobId: this.blobRegistry.save(bytes.buffer, bytes.byteOffset, bytes.byteLength),
+          offset: 0,
           size: bytes.byteLength,
           type: undefined, //no way to find the type using Ark
           name: path,
@@ -71,10 +72,16 @@ export class BlobTurboModule extends AnyThreadTurboModule {
       }
       const file = fs.openSync(query.url, fs.OpenMode.READ_ONLY);
       const stat = await fs.stat(query.url);
-      const blob: Blob = new ArrayBuffer(stat.size);
-      await fs.read(file.fd, blob);
+      // the file is read straight into the blob memory
+      const { blobId, buffer } = this.blobRegistry.allocate(stat.size);
+      try {
+        await fs.read(file.fd, buffer);
+      } catch (e) {
+        this.blobRegistry.deleteBlobById(blobId);
+        throw e;
+      }
       return {
-        blobId: this.blobRegistry.save(blob),
+        blobId,
         offset: 0,
         size: stat.size,
         type: undefined, //no way to find the type using Ark
@@ -151,10 +158,6 @@ export class BlobTurboModule extends AnyThreadTurboModule {
     return this.blobRegistry.findByMetadata(blob);
   }
 
-  createFromParts(parts: Array<BlobPart>, blobId: string): void {
-    this.blobRegistry.appendPartsToBlob(parts, blobId)
-  }
-
   sendOverSocket(blob: BlobMetadata, idDouble: number): void {
     const id = Math.floor(idDouble);
     const webSocketModule = this.getWebSocketModule();
@@ -188,10 +191,6 @@ export class BlobTurboModule extends AnyThreadTurboModule {
     module.setContentHandler(socketID, null);
   }
 
-  release(blobId: string): void {
-    this.blobRegistry.deleteBlobById(blobId)
-  }
-
   getConstants() {
     return { BLOB_URI_SCHEME: 'blob', BLOB_URI_HOST: null };
   }